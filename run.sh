@@ -0,0 +1,3 @@
+#! /usr/bin/bash
+
+g++ -O2 -pthread src/main.cpp -o main -lGLEW -lglfw -lGL -lGLU -lEGL && ./main "$@"
\ No newline at end of file
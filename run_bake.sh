@@ -0,0 +1,3 @@
+#! /usr/bin/bash
+
+g++ -O2 -pthread src/main_bake.cpp -o main_bake && ./main_bake "$@"
@@ -0,0 +1,3 @@
+#! /usr/bin/bash
+
+g++ -O2 -pthread src/main_bench.cpp -o main_bench && ./main_bench "$@"
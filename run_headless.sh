@@ -0,0 +1,3 @@
+#! /usr/bin/bash
+
+g++ -O2 -pthread src/main_headless.cpp -o main_headless && ./main_headless "$@"
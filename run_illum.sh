@@ -1,3 +0,0 @@
-#! /usr/bin/bash
-
-g++ src/main_illum.cpp -o main -lGLEW -lglfw -lGL -lGLU && ./main
\ No newline at end of file
@@ -0,0 +1,192 @@
+#pragma once
+
+#include "nbody.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+// Octree de Barnes–Hut. Todos os nós ficam num único vetor (pool) que é
+// limpo e reconstruído a cada passo sem liberar memória, então depois do
+// primeiro passo a construção não faz nenhuma alocação no heap.
+const int BH_MAX_DEPTH = 48;
+const int BH_LEAF_SIZE = 8;     // Corpos por folha antes de dividir
+
+struct OctreeNode {
+    double cx, cy, cz, half;    // Centro e meia aresta do cubo
+    double mx, my, mz, gm;      // Centro de massa e GM total
+    int firstChild;             // Índice do primeiro dos 8 filhos (-1 = folha)
+    int firstBody;              // Lista de corpos da folha (-1 = vazia)
+    int bodyCount;              // Tamanho da lista da folha
+};
+
+struct BarnesHutTree {
+    double theta = 0.5;                 // Ângulo de abertura
+    std::vector<OctreeNode> nodes;      // Pool de nós
+    std::vector<int> nextBody;          // Lista encadeada de corpos por folha
+
+    int newLeaf(double cx, double cy, double cz, double half) {
+        nodes.push_back({ cx, cy, cz, half, 0.0, 0.0, 0.0, 0.0, -1, -1, 0 });
+        return static_cast<int>(nodes.size() - 1);
+    }
+
+    static int octant(const OctreeNode& n, double x, double y, double z) {
+        return (x >= n.cx ? 1 : 0) | (y >= n.cy ? 2 : 0) | (z >= n.cz ? 4 : 0);
+    }
+
+    // Divide uma folha em 8 filhos contíguos no pool
+    void split(int node) {
+        int first = static_cast<int>(nodes.size());
+        double h = nodes[node].half * 0.5;
+        double cx = nodes[node].cx, cy = nodes[node].cy, cz = nodes[node].cz;
+        for (int o = 0; o < 8; ++o) {
+            newLeaf(cx + ((o & 1) ? h : -h), cy + ((o & 2) ? h : -h), cz + ((o & 4) ? h : -h), h);
+        }
+        nodes[node].firstChild = first;
+    }
+
+    void pushBody(int node, int body) {
+        nextBody[body] = nodes[node].firstBody;
+        nodes[node].firstBody = body;
+        nodes[node].bodyCount++;
+    }
+
+    void insert(const BodyStore& s, int body) {
+        int node = 0;
+        for (int depth = 0; ; ++depth) {
+            if (nodes[node].firstChild >= 0) {
+                node = nodes[node].firstChild + octant(nodes[node], s.x[body], s.y[body], s.z[body]);
+                continue;
+            }
+            // Folha com espaço ou profundidade máxima (corpos coincidentes): empilha na folha
+            if (nodes[node].bodyCount < BH_LEAF_SIZE || depth >= BH_MAX_DEPTH) {
+                pushBody(node, body);
+                return;
+            }
+            // Folha cheia: divide e redistribui os ocupantes um nível abaixo
+            int occupant = nodes[node].firstBody;
+            nodes[node].firstBody = -1;
+            nodes[node].bodyCount = 0;
+            split(node);
+            while (occupant >= 0) {
+                int next = nextBody[occupant];
+                pushBody(nodes[node].firstChild + octant(nodes[node], s.x[occupant], s.y[occupant], s.z[occupant]), occupant);
+                occupant = next;
+            }
+        }
+    }
+
+    void build(const BodyStore& s) {
+        nodes.clear();
+        nextBody.assign(s.count, -1);
+        if (s.count == 0) return;
+
+        double minX = s.x[0], maxX = s.x[0];
+        double minY = s.y[0], maxY = s.y[0];
+        double minZ = s.z[0], maxZ = s.z[0];
+        for (size_t i = 1; i < s.count; ++i) {
+            minX = std::min(minX, s.x[i]); maxX = std::max(maxX, s.x[i]);
+            minY = std::min(minY, s.y[i]); maxY = std::max(maxY, s.y[i]);
+            minZ = std::min(minZ, s.z[i]); maxZ = std::max(maxZ, s.z[i]);
+        }
+        double half = 0.5 * std::max({ maxX - minX, maxY - minY, maxZ - minZ });
+        half = half * 1.0001 + 1.0;
+        newLeaf(0.5 * (minX + maxX), 0.5 * (minY + maxY), 0.5 * (minZ + maxZ), half);
+
+        for (size_t i = 0; i < s.count; ++i) {
+            insert(s, static_cast<int>(i));
+        }
+
+        // Filhos sempre têm índice maior que o pai: percorrer o pool de trás
+        // para frente calcula os centros de massa de baixo para cima
+        for (size_t n = nodes.size(); n-- > 0; ) {
+            OctreeNode& node = nodes[n];
+            double gm = 0.0, mx = 0.0, my = 0.0, mz = 0.0;
+            if (node.firstChild >= 0) {
+                for (int c = 0; c < 8; ++c) {
+                    const OctreeNode& child = nodes[node.firstChild + c];
+                    gm += child.gm;
+                    mx += child.mx * child.gm;
+                    my += child.my * child.gm;
+                    mz += child.mz * child.gm;
+                }
+            } else {
+                for (int b = node.firstBody; b >= 0; b = nextBody[b]) {
+                    gm += s.gm[b];
+                    mx += s.x[b] * s.gm[b];
+                    my += s.y[b] * s.gm[b];
+                    mz += s.z[b] * s.gm[b];
+                }
+            }
+            node.gm = gm;
+            if (gm > 0.0) {
+                node.mx = mx / gm;
+                node.my = my / gm;
+                node.mz = mz / gm;
+            } else {
+                node.mx = node.cx;
+                node.my = node.cy;
+                node.mz = node.cz;
+            }
+        }
+    }
+
+    // Percorre a árvore para os corpos i em [begin, end); mesma assinatura dos
+    // kernels diretos, escrevendo só em ax/ay/az[i] (e pot[i])
+    void accelerations(BodyStore& s, size_t begin, size_t end) const {
+        if (s.computePotential) walk<true>(s, begin, end);
+        else walk<false>(s, begin, end);
+    }
+
+    template <bool Potential>
+    void walk(BodyStore& s, size_t begin, size_t end) const {
+        const double theta2 = theta * theta;
+        int stack[8 * BH_MAX_DEPTH + 8];
+
+        for (size_t i = begin; i < end; ++i) {
+            double axi = 0.0, ayi = 0.0, azi = 0.0, poti = 0.0;
+            if (!s.pinned[i] && !nodes.empty()) {
+                const double xi = s.x[i], yi = s.y[i], zi = s.z[i];
+                int top = 0;
+                stack[top++] = 0;
+                while (top > 0) {
+                    const OctreeNode& node = nodes[stack[--top]];
+                    if (node.gm == 0.0) continue;
+
+                    if (node.firstChild < 0) {
+                        for (int b = node.firstBody; b >= 0; b = nextBody[b]) {
+                            double dx = s.x[b] - xi, dy = s.y[b] - yi, dz = s.z[b] - zi;
+                            double r2 = dx * dx + dy * dy + dz * dz;
+                            if (r2 == 0.0) continue;
+                            double r = std::sqrt(r2);
+                            double f = s.gm[b] / (r2 * r);
+                            axi += dx * f; ayi += dy * f; azi += dz * f;
+                            if (Potential) poti -= s.gm[b] / r;
+                        }
+                        continue;
+                    }
+
+                    double dx = node.mx - xi, dy = node.my - yi, dz = node.mz - zi;
+                    double r2 = dx * dx + dy * dy + dz * dz;
+                    double size = 2.0 * node.half;
+                    bool inside = std::fabs(xi - node.cx) <= node.half &&
+                                  std::fabs(yi - node.cy) <= node.half &&
+                                  std::fabs(zi - node.cz) <= node.half;
+                    // Critério de abertura: tamanho / distância < θ e o corpo fora do cubo
+                    if (!inside && size * size < theta2 * r2) {
+                        double r = std::sqrt(r2);
+                        double f = node.gm / (r2 * r);
+                        axi += dx * f; ayi += dy * f; azi += dz * f;
+                        if (Potential) poti -= node.gm / r;
+                    } else {
+                        for (int c = 0; c < 8; ++c) stack[top++] = node.firstChild + c;
+                    }
+                }
+            }
+            s.ax[i] = axi;
+            s.ay[i] = ayi;
+            s.az[i] = azi;
+            if (Potential) s.pot[i] = poti;
+        }
+    }
+};
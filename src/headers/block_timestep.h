@@ -0,0 +1,188 @@
+#pragma once
+
+#include "nbody.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+
+// Passos de tempo hierárquicos em blocos de potência de dois. Cada corpo i
+// tem um nível k e passo dt/2^k, escolhido pelo critério de Aarseth
+// dt_i = η·|a|/|j| (aceleração e jerk). O passo global dt é dividido em
+// 2^maxLevel ticks; em cada evento todos os corpos fazem drift (barato) e
+// só os que terminam o próprio passo recalculam a força (KDK individual).
+// No fim de cada dt todos os corpos estão sincronizados.
+//
+// O jerk inicial é analítico; depois é a diferença entre as duas últimas
+// acelerações do corpo, o que deixa a força com o kernel SIMD do nbody.h.
+struct BlockTimesteps {
+    int maxLevel = 8;       // Menor passo = dt / 2^maxLevel
+    double eta = 0.02;      // Precisão do critério de passo
+
+    std::vector<int> level;
+    std::vector<uint64_t> nextTick;     // Tick em que o passo atual do corpo termina
+    std::vector<double> jx, jy, jz;     // Jerk da última avaliação
+    std::vector<double> oldAcc;         // Aceleração anterior dos corpos ativos (3 por corpo)
+    std::vector<int> active;
+    bool initialized = false;
+
+    // Estatísticas: forças recalculadas vs. o que um passo único no menor nível usado exigiria
+    uint64_t forceEvaluations = 0;
+    uint64_t sharedStepEvaluations = 0;
+
+    void invalidate() { initialized = false; }
+
+    // Aceleração e jerk do corpo i devido a todos os outros (soma direta)
+    static void accelerationAndJerk(BodyStore& s, size_t i, double& jxi, double& jyi, double& jzi) {
+        double axi = 0.0, ayi = 0.0, azi = 0.0;
+        jxi = jyi = jzi = 0.0;
+        const double xi = s.x[i], yi = s.y[i], zi = s.z[i];
+        const double vxi = s.vx[i], vyi = s.vy[i], vzi = s.vz[i];
+        for (size_t j = 0; j < s.count; ++j) {
+            double dx = s.x[j] - xi, dy = s.y[j] - yi, dz = s.z[j] - zi;
+            double r2 = dx * dx + dy * dy + dz * dz;
+            if (r2 == 0.0) continue;
+            double dvx = s.vx[j] - vxi, dvy = s.vy[j] - vyi, dvz = s.vz[j] - vzi;
+            double inv2 = 1.0 / r2;
+            double f = s.gm[j] * inv2 * std::sqrt(inv2);
+            double rv = 3.0 * (dx * dvx + dy * dvy + dz * dvz) * inv2;
+            axi += f * dx;
+            ayi += f * dy;
+            azi += f * dz;
+            jxi += f * (dvx - rv * dx);
+            jyi += f * (dvy - rv * dy);
+            jzi += f * (dvz - rv * dz);
+        }
+        s.ax[i] = axi;
+        s.ay[i] = ayi;
+        s.az[i] = azi;
+    }
+
+    // analytic: jerk pela fórmula fechada (só na inicialização); senão por
+    // diferença finita sobre o passo de cada corpo, com dtMin do tick
+    void computeActive(BodyStore& s, ThreadPool* pool, bool analytic, double dtMin) {
+        GravityKernel kernel = activeGravityKernel();
+        oldAcc.resize(3 * active.size());
+        auto chunk = [&](size_t b, size_t e) {
+            for (size_t k = b; k < e; ++k) {
+                size_t i = active[k];
+                if (analytic) {
+                    accelerationAndJerk(s, i, jx[i], jy[i], jz[i]);
+                    continue;
+                }
+                oldAcc[3 * k] = s.ax[i];
+                oldAcc[3 * k + 1] = s.ay[i];
+                oldAcc[3 * k + 2] = s.az[i];
+                kernel(s, i, i + 1);
+                double inv = 1.0 / (period(i) * dtMin);
+                jx[i] = (s.ax[i] - oldAcc[3 * k]) * inv;
+                jy[i] = (s.ay[i] - oldAcc[3 * k + 1]) * inv;
+                jz[i] = (s.az[i] - oldAcc[3 * k + 2]) * inv;
+            }
+        };
+        if (pool && pool->threadCount() > 1 && active.size() >= 64) {
+            pool->parallelFor(0, active.size(), std::max<size_t>(4, active.size() / (pool->threadCount() * 8)), chunk);
+        } else {
+            chunk(0, active.size());
+        }
+        forceEvaluations += active.size();
+    }
+
+    // Nível desejado pelo critério de Aarseth
+    int desiredLevel(const BodyStore& s, size_t i, double dtMax) const {
+        double a = std::sqrt(s.ax[i] * s.ax[i] + s.ay[i] * s.ay[i] + s.az[i] * s.az[i]);
+        double j = std::sqrt(jx[i] * jx[i] + jy[i] * jy[i] + jz[i] * jz[i]);
+        if (j == 0.0 || a == 0.0) return 0;
+        double dt = eta * a / j;
+        int k = static_cast<int>(std::ceil(std::log2(dtMax / dt)));
+        return std::max(0, std::min(maxLevel, k));
+    }
+
+    uint64_t period(size_t i) const { return 1ull << (maxLevel - level[i]); }
+
+    void step(BodyStore& s, ThreadPool* pool, double dtMax) {
+        const uint64_t T = 1ull << maxLevel;
+        const double dtMin = dtMax / T;
+
+        if (!initialized || level.size() != s.count) {
+            level.assign(s.count, 0);
+            nextTick.assign(s.count, 0);
+            jx.assign(s.count, 0.0);
+            jy.assign(s.count, 0.0);
+            jz.assign(s.count, 0.0);
+            active.clear();
+            for (size_t i = 0; i < s.count; ++i) {
+                if (!s.pinned[i]) active.push_back(static_cast<int>(i));
+            }
+            computeActive(s, pool, true, dtMin);
+            for (int i : active) level[i] = desiredLevel(s, i, dtMax);
+            initialized = true;
+        }
+
+        // t = 0: todos sincronizados, abrem um passo com meio kick
+        int finest = 0;
+        for (size_t i = 0; i < s.count; ++i) {
+            if (s.pinned[i]) continue;
+            double h = 0.5 * period(i) * dtMin;
+            s.vx[i] += s.ax[i] * h;
+            s.vy[i] += s.ay[i] * h;
+            s.vz[i] += s.az[i] * h;
+            nextTick[i] = period(i);
+            finest = std::max(finest, level[i]);
+        }
+
+        uint64_t t = 0;
+        while (t < T) {
+            uint64_t next = T;
+            for (size_t i = 0; i < s.count; ++i) {
+                if (!s.pinned[i]) next = std::min(next, nextTick[i]);
+            }
+
+            double h = (next - t) * dtMin;
+            for (size_t i = 0; i < s.count; ++i) {
+                if (s.pinned[i]) continue;
+                s.x[i] += s.vx[i] * h;
+                s.y[i] += s.vy[i] * h;
+                s.z[i] += s.vz[i] * h;
+            }
+            t = next;
+
+            active.clear();
+            for (size_t i = 0; i < s.count; ++i) {
+                if (!s.pinned[i] && nextTick[i] == t) active.push_back(static_cast<int>(i));
+            }
+            computeActive(s, pool, false, dtMin);
+
+            for (int i : active) {
+                // Meio kick de fechamento com o passo antigo
+                double close = 0.5 * period(i) * dtMin;
+                s.vx[i] += s.ax[i] * close;
+                s.vy[i] += s.ay[i] * close;
+                s.vz[i] += s.az[i] * close;
+
+                // Novo nível: pode refinar sempre; só engrossa um nível e se t estiver alinhado
+                int want = desiredLevel(s, i, dtMax);
+                if (want > level[i]) {
+                    level[i] = want;
+                } else if (want < level[i] && t % (period(i) * 2) == 0) {
+                    level[i] -= 1;
+                }
+                finest = std::max(finest, level[i]);
+
+                if (t < T) {
+                    double open = 0.5 * period(i) * dtMin;
+                    s.vx[i] += s.ax[i] * open;
+                    s.vy[i] += s.ay[i] * open;
+                    s.vz[i] += s.az[i] * open;
+                    nextTick[i] = t + period(i);
+                }
+            }
+        }
+
+        size_t moving = 0;
+        for (size_t i = 0; i < s.count; ++i) moving += !s.pinned[i];
+        sharedStepEvaluations += moving << finest;
+    }
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "nbody.h"
+#include "gravity.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+
+
+// Energia total e momento angular dos corpos massivos (as partículas de
+// teste não têm massa e ficam de fora), amostrados a cada `cadence` passos.
+// O potencial sai do próprio laço de forças: no passo amostrado o Simulation
+// liga computePotential e, quando a última avaliação do integrador caiu nas
+// posições finais (composições com FSAL: leapfrog, yoshida4, forest-ruth),
+// pot[] já está pronto. Com euler, blocos ou WH a última avaliação não está
+// no fim do passo, então é feita uma passada só de potencial.
+// Os valores ficam multiplicados por G (o store só guarda GM), o que não muda
+// o desvio relativo.
+struct ConservationState {
+    double energy = 0.0;                    // G·E
+    double lx = 0.0, ly = 0.0, lz = 0.0;    // G·L
+};
+
+// pot[i] = −Σ GMj/rij por soma direta, para i em [begin, end), inclusive corpos fixos
+inline void potentialRange(BodyStore& s, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        double p = 0.0;
+        const double xi = s.x[i], yi = s.y[i], zi = s.z[i];
+        for (size_t j = 0; j < s.count; ++j) {
+            double dx = s.x[j] - xi, dy = s.y[j] - yi, dz = s.z[j] - zi;
+            double r2 = dx * dx + dy * dy + dz * dz;
+            if (r2 == 0.0) continue;
+            p -= s.gm[j] / std::sqrt(r2);
+        }
+        s.pot[i] = p;
+    }
+}
+
+inline ConservationState measureConservation(const BodyStore& s) {
+    ConservationState c;
+    for (size_t i = 0; i < s.count; ++i) {
+        double vx = s.vx[i], vy = s.vy[i], vz = s.vz[i];
+        double v2 = vx * vx + vy * vy + vz * vz;
+        // Cada par aparece em pot[i] e pot[j]: metade para cada
+        c.energy += s.gm[i] * (0.5 * v2 + 0.5 * s.pot[i]);
+        c.lx += s.gm[i] * (s.y[i] * vz - s.z[i] * vy);
+        c.ly += s.gm[i] * (s.z[i] * vx - s.x[i] * vz);
+        c.lz += s.gm[i] * (s.x[i] * vy - s.y[i] * vx);
+    }
+    return c;
+}
+
+struct ConservationMonitor {
+    uint64_t cadence = 0;       // Passos entre amostras (0 = desligado)
+    double maxDrift = 0.0;      // Desvio que encerra uma execução headless (0 = nunca)
+
+    bool hasReference = false;
+    ConservationState reference, last;
+    double energyDrift = 0.0, momentumDrift = 0.0;     // Da última amostra
+    double worstDrift = 0.0;                            // Maior dos dois em todas as amostras
+
+    bool enabled() const { return cadence > 0; }
+    bool due(uint64_t step) const { return cadence > 0 && step % cadence == 0; }
+    bool exceeded() const { return maxDrift > 0.0 && worstDrift > maxDrift; }
+
+    // A próxima amostra vira a referência (ex.: troca de backend, cujo
+    // potencial aproximado tem outro zero)
+    void reset() { hasReference = false; }
+
+    // potentialReady: pot[] veio do laço de forças nas posições atuais (os
+    // corpos fixos, pulados pelos kernels, são completados aqui)
+    void sample(BodyStore& s, bool potentialReady, ThreadPool* pool, uint64_t step, double time) {
+        if (potentialReady) {
+            for (size_t i = 0; i < s.count; ++i) {
+                if (s.pinned[i]) potentialRange(s, i, i + 1);
+            }
+        } else if (pool && pool->threadCount() > 1 && s.count >= PARALLEL_MIN_BODIES) {
+            pool->parallelFor(0, s.count, std::max<size_t>(16, s.count / (pool->threadCount() * 8)),
+                [&](size_t b, size_t e) { potentialRange(s, b, e); });
+        } else {
+            potentialRange(s, 0, s.count);
+        }
+
+        last = measureConservation(s);
+        if (!hasReference) {
+            reference = last;
+            hasReference = true;
+        }
+        energyDrift = relative(last.energy - reference.energy, reference.energy);
+        double dlx = last.lx - reference.lx, dly = last.ly - reference.ly, dlz = last.lz - reference.lz;
+        double l0 = std::sqrt(reference.lx * reference.lx + reference.ly * reference.ly + reference.lz * reference.lz);
+        momentumDrift = relative(std::sqrt(dlx * dlx + dly * dly + dlz * dlz), l0);
+        worstDrift = std::max(worstDrift, std::max(energyDrift, momentumDrift));
+
+        std::fprintf(stderr, "conservation  step %llu  t %.4f yr  dE/E %.3e  dL/L %.3e\n",
+                     static_cast<unsigned long long>(step), time / (365.25 * 86400.0), energyDrift, momentumDrift);
+    }
+
+private:
+    static double relative(double delta, double ref) {
+        return ref != 0.0 ? std::fabs(delta / ref) : std::fabs(delta);
+    }
+};
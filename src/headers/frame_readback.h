@@ -0,0 +1,215 @@
+#pragma once
+
+#include "libs.h"
+#include "gpu_memory.h"
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+// Leitura dos quadros renderizados sem parar a renderização: capture() só
+// enfileira um glReadPixels para o próximo PBO do anel (a cópia roda na GPU)
+// e põe uma fence; o PBO do quadro N é mapeado na captura do quadro
+// N + READBACK_BUFFERS, logo antes de o slot ser reusado, quando a cópia já
+// terminou. Os pixels vão para uma thread que converte e
+// grava cada quadro como PPM (frame_000000.ppm, ...) em `directory`, então
+// glReadPixels e o disco nunca seguram o laço de renderização. Se o disco
+// ficar mais de READBACK_MAX_QUEUED quadros atrás, capture() espera uma vaga
+// em vez de acumular memória sem limite.
+const int READBACK_BUFFERS = 3;
+const size_t READBACK_MAX_QUEUED = 16;
+
+class FrameWriter {
+public:
+    FrameWriter() = default;
+    FrameWriter(const FrameWriter&) = delete;
+    FrameWriter& operator=(const FrameWriter&) = delete;
+    ~FrameWriter() { stop(); }
+
+    void start(const std::string& outputDirectory, int frameWidth, int frameHeight) {
+        directory = outputDirectory;
+        width = frameWidth;
+        height = frameHeight;
+        done = false;
+        allocated = 0;
+        MemoryRegistry::instance().add(MemoryObject::Host, reinterpret_cast<uintptr_t>(this), MemoryCategory::Host,
+                                       "frame writer buffers");
+        worker = std::thread([this] { writeLoop(); });
+    }
+
+    // Buffer RGBA livre do tamanho de um quadro (reaproveitado)
+    std::vector<unsigned char> acquire() {
+        std::unique_lock<std::mutex> lock(mutex);
+        space.wait(lock, [&] { return queue.size() < READBACK_MAX_QUEUED; });
+        if (spare.empty()) {
+            size_t bytes = static_cast<size_t>(width) * height * 4;
+            MemoryRegistry::instance().setBytes(MemoryObject::Host, reinterpret_cast<uintptr_t>(this), ++allocated * bytes);
+            return std::vector<unsigned char>(bytes);
+        }
+        std::vector<unsigned char> pixels = std::move(spare.back());
+        spare.pop_back();
+        return pixels;
+    }
+
+    void push(uint64_t frame, std::vector<unsigned char>&& pixels) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.push_back({ frame, std::move(pixels) });
+        }
+        ready.notify_one();
+    }
+
+    // Grava o que falta na fila e encerra a thread
+    void stop() {
+        if (!worker.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            done = true;
+        }
+        ready.notify_one();
+        worker.join();
+        std::vector<std::vector<unsigned char>>().swap(spare);
+        MemoryRegistry::instance().remove(MemoryObject::Host, reinterpret_cast<uintptr_t>(this));
+    }
+
+    uint64_t written = 0;
+    uint64_t failures = 0;
+
+private:
+    struct PendingFrame {
+        uint64_t frame;
+        std::vector<unsigned char> pixels;
+    };
+
+    void writeLoop() {
+        std::vector<unsigned char> row(static_cast<size_t>(width) * 3);
+        for (;;) {
+            PendingFrame pending;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                ready.wait(lock, [&] { return done || !queue.empty(); });
+                if (queue.empty()) return;
+                pending = std::move(queue.front());
+                queue.pop_front();
+            }
+            space.notify_one();
+
+            if (writeFrame(pending, row)) ++written;
+            else ++failures;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            spare.push_back(std::move(pending.pixels));
+        }
+    }
+
+    // PPM binário (P6); o GL lê de baixo para cima, então as linhas são invertidas
+    bool writeFrame(const PendingFrame& pending, std::vector<unsigned char>& row) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "/frame_%06llu.ppm", static_cast<unsigned long long>(pending.frame));
+        std::string path = directory + name;
+        std::FILE* out = std::fopen(path.c_str(), "wb");
+        if (!out) return false;
+        bool ok = std::fprintf(out, "P6\n%d %d\n255\n", width, height) > 0;
+        for (int y = height - 1; y >= 0 && ok; --y) {
+            const unsigned char* src = &pending.pixels[static_cast<size_t>(y) * width * 4];
+            for (int x = 0; x < width; ++x) {
+                row[3 * x + 0] = src[4 * x + 0];
+                row[3 * x + 1] = src[4 * x + 1];
+                row[3 * x + 2] = src[4 * x + 2];
+            }
+            ok = std::fwrite(row.data(), 1, row.size(), out) == row.size();
+        }
+        return std::fclose(out) == 0 && ok;
+    }
+
+    std::string directory;
+    int width = 0, height = 0;
+    bool done = false;
+    size_t allocated = 0;   // Buffers de quadro já criados (fila + reuso + em uso)
+    std::thread worker;
+
+    std::mutex mutex;
+    std::condition_variable ready;      // Quadro novo na fila (ou fim)
+    std::condition_variable space;      // Vaga na fila
+    std::deque<PendingFrame> queue;
+    std::vector<std::vector<unsigned char>> spare;   // Buffers já gravados, para reuso
+};
+
+// Anel de PBOs para o framebuffer de leitura atual
+struct FrameReadback {
+    GLuint pbos[READBACK_BUFFERS] = {};
+    GLsync fences[READBACK_BUFFERS] = {};
+    uint64_t frames[READBACK_BUFFERS] = {};
+    int width = 0, height = 0;
+    uint64_t issued = 0, collected = 0;
+    FrameWriter writer;
+
+    void init(int frameWidth, int frameHeight, const std::string& directory) {
+        width = frameWidth;
+        height = frameHeight;
+        size_t bytes = static_cast<size_t>(width) * height * 4;
+        for (GLuint& pbo : pbos) {
+            pbo = genTrackedBuffer(MemoryCategory::Target, "readback PBO");
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo);
+            trackedBufferData(GL_PIXEL_PACK_BUFFER, pbo, bytes, nullptr, GL_STREAM_READ);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        writer.start(directory, width, height);
+    }
+
+    // Depois de desenhar o quadro `frame`; entrega à thread de gravação o
+    // quadro lido READBACK_BUFFERS chamadas atrás, dono do slot reusado agora
+    void capture(uint64_t frame) {
+        int slot = static_cast<int>(issued % READBACK_BUFFERS);
+        if (issued - collected == READBACK_BUFFERS) collect();
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[slot]);
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        frames[slot] = frame;
+        ++issued;
+    }
+
+    // Entrega os quadros ainda nos PBOs e espera a gravação de todos
+    void finish() {
+        while (collected < issued) collect();
+        writer.stop();
+    }
+
+    void destroy() {
+        for (GLsync& fence : fences) {
+            if (fence) glDeleteSync(fence);
+            fence = nullptr;
+        }
+        for (GLuint& pbo : pbos) deleteTrackedBuffer(pbo);
+    }
+
+private:
+    // Mapeia o PBO mais antigo; a fence normalmente já passou
+    void collect() {
+        int slot = static_cast<int>(collected % READBACK_BUFFERS);
+        ++collected;
+        glClientWaitSync(fences[slot], GL_SYNC_FLUSH_COMMANDS_BIT, GLuint64(1000000000));
+        glDeleteSync(fences[slot]);
+        fences[slot] = nullptr;
+
+        size_t bytes = static_cast<size_t>(width) * height * 4;
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[slot]);
+        const void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(bytes), GL_MAP_READ_BIT);
+        if (mapped) {
+            std::vector<unsigned char> pixels = writer.acquire();
+            std::memcpy(pixels.data(), mapped, bytes);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            writer.push(frames[slot], std::move(pixels));
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+};
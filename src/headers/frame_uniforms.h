@@ -0,0 +1,61 @@
+#pragma once
+
+#include "libs.h"
+#include "gpu_memory.h"
+
+
+// Dados por quadro (câmera e luz) num uniform block std140, enviados uma
+// única vez por quadro e compartilhados por todos os programas pelo ponto de
+// ligação FRAME_UNIFORM_BINDING. Os shaders incluem FRAME_UNIFORM_BLOCK logo
+// depois do #version.
+const GLuint FRAME_UNIFORM_BINDING = 0;
+
+#define FRAME_UNIFORM_BLOCK \
+    "layout(std140) uniform Frame {\n" \
+    "    mat4 view;\n" \
+    "    mat4 projection;\n" \
+    "    vec4 viewPos;\n" \
+    "    vec4 lightPos;\n" \
+    "    vec4 lightColor;\n" \
+    "};\n"
+
+// Mesmo layout do bloco acima (vec3 ocupam 16 bytes no std140)
+struct FrameUniformData {
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::vec4 viewPos;
+    glm::vec4 lightPos;
+    glm::vec4 lightColor;
+};
+
+// Liga o bloco "Frame" do programa ao ponto compartilhado (uma vez, após o link)
+inline void bindFrameUniforms(GLuint program) {
+    GLuint index = glGetUniformBlockIndex(program, "Frame");
+    if (index != GL_INVALID_INDEX) glUniformBlockBinding(program, index, FRAME_UNIFORM_BINDING);
+}
+
+struct FrameUniforms {
+    GLuint UBO = 0;
+    FrameUniformData data;
+
+    void init() {
+        data.lightPos = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);     // Sol na origem
+        data.lightColor = glm::vec4(1.0f);                      // Luz branca
+        UBO = genTrackedBuffer(MemoryCategory::Dynamic, "frame uniforms");
+        glBindBuffer(GL_UNIFORM_BUFFER, UBO);
+        trackedBufferData(GL_UNIFORM_BUFFER, UBO, sizeof(FrameUniformData), nullptr, GL_DYNAMIC_DRAW);
+        glBindBufferBase(GL_UNIFORM_BUFFER, FRAME_UNIFORM_BINDING, UBO);
+    }
+
+    void update(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& viewPos) {
+        data.view = view;
+        data.projection = projection;
+        data.viewPos = glm::vec4(viewPos, 1.0f);
+        glBindBuffer(GL_UNIFORM_BUFFER, UBO);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(FrameUniformData), &data);
+    }
+
+    void destroy() {
+        deleteTrackedBuffer(UBO);
+    }
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cmath>
+
+
+// Frustum de visão extraído de projection * view (Gribb–Hartmann), sem
+// dependência de OpenGL. Cada plano tem a normal apontando para dentro e é
+// normalizado, então o teste de uma esfera é uma distância com sinal.
+struct Frustum {
+    glm::vec4 planes[6];    // Esquerda, direita, baixo, cima, perto, longe
+
+    explicit Frustum(const glm::mat4& viewProjection) {
+        glm::vec4 rows[4];
+        for (int r = 0; r < 4; ++r) {
+            rows[r] = glm::vec4(viewProjection[0][r], viewProjection[1][r], viewProjection[2][r], viewProjection[3][r]);
+        }
+        planes[0] = rows[3] + rows[0];
+        planes[1] = rows[3] - rows[0];
+        planes[2] = rows[3] + rows[1];
+        planes[3] = rows[3] - rows[1];
+        planes[4] = rows[3] + rows[2];
+        planes[5] = rows[3] - rows[2];
+        for (glm::vec4& p : planes) {
+            p /= glm::length(glm::vec3(p));
+        }
+    }
+
+    // Falso só se a esfera está inteira fora de algum plano
+    bool sphereVisible(const glm::vec3& center, float radius) const {
+        for (const glm::vec4& p : planes) {
+            if (glm::dot(glm::vec3(p), center) + p.w < -radius) return false;
+        }
+        return true;
+    }
+};
+
+// Raio em pixels de uma esfera a `distance` da câmera. pixelsPerUnit é
+// projection[1][1] * altura da viewport / 2 (pixels por unidade a distância 1).
+inline float projectedRadius(float radius, float distance, float pixelsPerUnit) {
+    if (distance <= radius) return INFINITY;    // Câmera dentro da esfera
+    return radius * pixelsPerUnit / std::sqrt(distance * distance - radius * radius);
+}
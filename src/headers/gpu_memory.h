@@ -0,0 +1,84 @@
+#pragma once
+
+#include "libs.h"
+#include "memory_registry.h"
+
+
+// Criação e destruição de buffers, texturas e renderbuffers do GL já
+// registradas no MemoryRegistry. As funções de alocação recebem o objeto só
+// para a contabilidade: o alvo (target) deve estar ligado, como no GL.
+inline GLuint genTrackedBuffer(MemoryCategory category, const std::string& label) {
+    GLuint buffer = 0;
+    glGenBuffers(1, &buffer);
+    MemoryRegistry::instance().add(MemoryObject::Buffer, buffer, category, label);
+    return buffer;
+}
+
+inline void trackedBufferData(GLenum target, GLuint buffer, size_t bytes, const void* data, GLenum usage) {
+    glBufferData(target, static_cast<GLsizeiptr>(bytes), data, usage);
+    MemoryRegistry::instance().setBytes(MemoryObject::Buffer, buffer, bytes);
+}
+
+inline void trackedBufferStorage(GLenum target, GLuint buffer, size_t bytes, const void* data, GLbitfield flags) {
+    glBufferStorage(target, static_cast<GLsizeiptr>(bytes), data, flags);
+    MemoryRegistry::instance().setBytes(MemoryObject::Buffer, buffer, bytes);
+}
+
+inline void deleteTrackedBuffer(GLuint& buffer) {
+    if (!buffer) return;
+    MemoryRegistry::instance().remove(MemoryObject::Buffer, buffer);
+    glDeleteBuffers(1, &buffer);
+    buffer = 0;
+}
+
+inline GLuint genTrackedTexture(const std::string& label) {
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    MemoryRegistry::instance().add(MemoryObject::Texture, texture, MemoryCategory::Texture, label);
+    return texture;
+}
+
+// Depois de definir os níveis com glTexImage*
+inline void trackTextureBytes(GLuint texture, size_t bytes) {
+    MemoryRegistry::instance().setBytes(MemoryObject::Texture, texture, bytes);
+}
+
+inline void deleteTrackedTexture(GLuint& texture) {
+    if (!texture) return;
+    MemoryRegistry::instance().remove(MemoryObject::Texture, texture);
+    glDeleteTextures(1, &texture);
+    texture = 0;
+}
+
+inline GLuint genTrackedRenderbuffer(const std::string& label) {
+    GLuint renderbuffer = 0;
+    glGenRenderbuffers(1, &renderbuffer);
+    MemoryRegistry::instance().add(MemoryObject::Renderbuffer, renderbuffer, MemoryCategory::Target, label);
+    return renderbuffer;
+}
+
+inline void trackedRenderbufferStorage(GLuint renderbuffer, GLenum internalFormat, int width, int height,
+                                       size_t bytesPerPixel) {
+    glRenderbufferStorage(GL_RENDERBUFFER, internalFormat, width, height);
+    MemoryRegistry::instance().setBytes(MemoryObject::Renderbuffer, renderbuffer,
+                                        static_cast<size_t>(width) * height * bytesPerPixel);
+}
+
+inline void deleteTrackedRenderbuffer(GLuint& renderbuffer) {
+    if (!renderbuffer) return;
+    MemoryRegistry::instance().remove(MemoryObject::Renderbuffer, renderbuffer);
+    glDeleteRenderbuffers(1, &renderbuffer);
+    renderbuffer = 0;
+}
+
+// Bytes de uma textura com a cadeia completa de mipmaps até 1x1
+inline size_t mipChainBytes(int width, int height, int layers, size_t bytesPerTexel) {
+    size_t bytes = 0;
+    while (true) {
+        bytes += static_cast<size_t>(width) * height * layers * bytesPerTexel;
+        if (width == 1 && height == 1) break;
+        width = std::max(1, width / 2);
+        height = std::max(1, height / 2);
+    }
+    return bytes;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "libs.h"
+#include "profiler.h"
+
+
+// Tempo de GPU de cada passada com pares glBeginQuery/glEndQuery de
+// GL_TIME_ELAPSED (não aninham: uma passada por vez). As consultas de um
+// quadro só são lidas GPU_TIMER_FRAMES quadros depois, em beginFrame, e só se
+// o resultado já estiver disponível; senão são descartadas, então a leitura
+// nunca espera a GPU. Só mede com o Profiler ligado. O primeiro quadro é
+// descartado: no llvmpipe a primeira consulta volta com um valor inválido.
+const int GPU_TIMER_FRAMES = 3;
+const int GPU_TIMER_MAX_PASSES = 16;
+
+struct GpuTimer {
+    GLuint queries[GPU_TIMER_FRAMES][GPU_TIMER_MAX_PASSES] = {};
+    const char* names[GPU_TIMER_FRAMES][GPU_TIMER_MAX_PASSES] = {};
+    uint64_t submitted[GPU_TIMER_FRAMES][GPU_TIMER_MAX_PASSES] = {};  // profileNow() no begin
+    int counts[GPU_TIMER_FRAMES] = {};
+    uint64_t frame = 0;
+    bool open = false;
+
+    void init() {
+        glGenQueries(GPU_TIMER_FRAMES * GPU_TIMER_MAX_PASSES, &queries[0][0]);
+    }
+
+    // Entrega (nome, ms, enviado em) das passadas do quadro que usou este slot
+    template <typename Visitor>
+    void beginFrame(Visitor&& visit) {
+        int slot = static_cast<int>(frame % GPU_TIMER_FRAMES);
+        int first = frame == GPU_TIMER_FRAMES ? counts[slot] : 0;
+        for (int p = first; p < counts[slot]; ++p) {
+            GLuint available = 0;
+            glGetQueryObjectuiv(queries[slot][p], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available) break;
+            GLuint64 elapsed = 0;
+            glGetQueryObjectui64v(queries[slot][p], GL_QUERY_RESULT, &elapsed);
+            visit(names[slot][p], elapsed * 1e-6, submitted[slot][p]);
+        }
+        counts[slot] = 0;
+    }
+
+    void endFrame() { ++frame; }
+
+    void begin(const char* name) {
+        int slot = static_cast<int>(frame % GPU_TIMER_FRAMES);
+        if (open || counts[slot] == GPU_TIMER_MAX_PASSES || !Profiler::instance().enabled()) return;
+        names[slot][counts[slot]] = name;
+        submitted[slot][counts[slot]] = profileNow();
+        glBeginQuery(GL_TIME_ELAPSED, queries[slot][counts[slot]]);
+        open = true;
+    }
+
+    void end() {
+        if (!open) return;
+        glEndQuery(GL_TIME_ELAPSED);
+        ++counts[static_cast<int>(frame % GPU_TIMER_FRAMES)];
+        open = false;
+    }
+
+    void destroy() {
+        glDeleteQueries(GPU_TIMER_FRAMES * GPU_TIMER_MAX_PASSES, &queries[0][0]);
+    }
+};
+
+// Zona de CPU + consulta de GPU com o mesmo nome, durante o escopo
+class ProfilePass {
+public:
+    ProfilePass(GpuTimer& gpuTimer, const char* name) : zone(name), timer(gpuTimer) { timer.begin(name); }
+    ~ProfilePass() { timer.end(); }
+    ProfilePass(const ProfilePass&) = delete;
+    ProfilePass& operator=(const ProfilePass&) = delete;
+
+private:
+    ProfileZone zone;
+    GpuTimer& timer;
+};
+
+#define PROFILE_PASS(timer, name) ProfilePass PROFILE_CONCAT(profilePass, __LINE__)(timer, name)
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "nbody.h"
+#include "barnes_hut.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+
+// Seleção do método de cálculo da gravidade, trocável em tempo de execução
+enum class ForceBackend { Direct, BarnesHut };
+
+inline const char* forceBackendName(ForceBackend backend) {
+    return backend == ForceBackend::BarnesHut ? "barnes-hut" : "direct";
+}
+
+inline bool parseForceBackend(const char* name, ForceBackend& out) {
+    if (std::strcmp(name, "direct") == 0) { out = ForceBackend::Direct; return true; }
+    if (std::strcmp(name, "bh") == 0 || std::strcmp(name, "barnes-hut") == 0) {
+        out = ForceBackend::BarnesHut;
+        return true;
+    }
+    return false;
+}
+
+// Abaixo disso o laço de forças roda só na thread chamadora
+const size_t PARALLEL_MIN_BODIES = 256;
+
+struct GravitySolver {
+    ForceBackend backend = ForceBackend::Direct;
+    BarnesHutTree tree;
+    ThreadPool* pool = nullptr;     // nullptr = serial
+
+    // Blocos de corpos i por tarefa: ~8 blocos por thread para balancear
+    size_t chunkSize(size_t n) const {
+        size_t threads = pool ? pool->threadCount() : 1;
+        return std::max<size_t>(16, n / (threads * 8));
+    }
+
+    void computeAccelerations(BodyStore& s) {
+        bool parallel = pool && pool->threadCount() > 1 && s.count >= PARALLEL_MIN_BODIES;
+        if (backend == ForceBackend::BarnesHut) {
+            tree.build(s);
+            if (parallel) {
+                pool->parallelFor(0, s.count, chunkSize(s.count),
+                    [&](size_t b, size_t e) { tree.accelerations(s, b, e); });
+            } else {
+                tree.accelerations(s, 0, s.count);
+            }
+        } else {
+            GravityKernel kernel = activeGravityKernel();
+            if (parallel) {
+                pool->parallelFor(0, s.count, chunkSize(s.count),
+                    [&](size_t b, size_t e) { kernel(s, b, e); });
+            } else {
+                kernel(s, 0, s.count);
+            }
+        }
+    }
+
+    void toggleBackend() {
+        backend = backend == ForceBackend::Direct ? ForceBackend::BarnesHut : ForceBackend::Direct;
+    }
+};
+
+// Erro relativo |a - a_direto| / |a_direto| numa amostra de corpos
+struct ForceErrorReport {
+    size_t samples = 0;
+    double meanError = 0.0;
+    double maxError = 0.0;
+};
+
+// Compara o backend atual do solver com a soma direta em até `samples` corpos
+// espaçados uniformemente. As acelerações do store ficam as do backend atual.
+inline ForceErrorReport checkForceAccuracy(BodyStore& s, GravitySolver& solver, size_t samples = 64) {
+    ForceErrorReport report;
+    if (s.count == 0) return report;
+
+    solver.computeAccelerations(s);
+    size_t stride = std::max<size_t>(1, s.count / std::max<size_t>(1, samples));
+
+    std::vector<size_t> indices;
+    std::vector<double> saved;
+    for (size_t i = 0; i < s.count && indices.size() < samples; i += stride) {
+        if (s.pinned[i]) continue;
+        indices.push_back(i);
+        saved.insert(saved.end(), { s.ax[i], s.ay[i], s.az[i] });
+    }
+
+    for (size_t k = 0; k < indices.size(); ++k) {
+        size_t i = indices[k];
+        gravityKernelScalar(s, i, i + 1);
+        double ex = saved[3 * k] - s.ax[i];
+        double ey = saved[3 * k + 1] - s.ay[i];
+        double ez = saved[3 * k + 2] - s.az[i];
+        double ref = std::sqrt(s.ax[i] * s.ax[i] + s.ay[i] * s.ay[i] + s.az[i] * s.az[i]);
+        double err = ref > 0.0 ? std::sqrt(ex * ex + ey * ey + ez * ez) / ref : 0.0;
+        report.meanError += err;
+        report.maxError = std::max(report.maxError, err);
+
+        s.ax[i] = saved[3 * k];
+        s.ay[i] = saved[3 * k + 1];
+        s.az[i] = saved[3 * k + 2];
+    }
+    report.samples = indices.size();
+    if (report.samples > 0) report.meanError /= report.samples;
+    return report;
+}
+
+inline void printForceAccuracy(BodyStore& s, GravitySolver& solver) {
+    ForceErrorReport r = checkForceAccuracy(s, solver);
+    std::cout << "Gravity backend: " << forceBackendName(solver.backend);
+    if (solver.backend == ForceBackend::BarnesHut) std::cout << " (theta = " << solver.tree.theta << ")";
+    std::cout << " | force error vs direct on " << r.samples << " bodies: mean "
+              << r.meanError << ", max " << r.maxError << std::endl;
+}
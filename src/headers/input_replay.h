@@ -0,0 +1,137 @@
+#pragma once
+
+#include "profiler.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+// Gravação e reprodução da entrada para medições repetíveis do renderizador.
+// Com --record cada quadro grava um InputFrame: as teclas lidas no quadro, a
+// câmera resultante e o passo da física que foi desenhado. Com --replay a
+// câmera vem do arquivo, as teclas de ação (B, T) são repetidas no mesmo
+// quadro e a thread da física avança em lockstep até o passo gravado, então
+// toda reprodução desenha as mesmas cenas na mesma ordem, sem limite de
+// quadros por segundo, e termina com as estatísticas do tempo de quadro.
+//
+// Formato (little-endian, sem padding): InputRecordingHeader e um
+// InputFrame por quadro até o fim do arquivo.
+const uint32_t INPUT_RECORDING_MAGIC = 0x50525353;     // "SSRP"
+const uint32_t INPUT_RECORDING_VERSION = 1;
+
+struct InputRecordingHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t width, height;     // Tamanho da janela na gravação (aspecto da projeção)
+    double dt;                  // Passo da física na gravação
+};
+
+struct InputFrame {
+    uint64_t steps;             // Passo da física desenhado neste quadro
+    uint32_t keys;              // Bit k = k-ésima tecla da tabela do executável
+    int32_t followed;           // Astro seguido pela câmera (-1 = câmera livre)
+    float position[3];          // Posição da câmera
+    float target[3];            // Ponto para onde ela olha
+};
+
+static_assert(sizeof(InputRecordingHeader) == 24, "InputRecordingHeader must have no padding");
+static_assert(sizeof(InputFrame) == 40, "InputFrame must have no padding");
+
+class InputRecorder {
+public:
+    InputRecorder() = default;
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+    ~InputRecorder() { close(); }
+
+    bool open(const char* path, uint32_t width, uint32_t height, double dt) {
+        out = std::fopen(path, "wb");
+        if (!out) return false;
+        InputRecordingHeader header = { INPUT_RECORDING_MAGIC, INPUT_RECORDING_VERSION, width, height, dt };
+        return std::fwrite(&header, sizeof(header), 1, out) == 1;
+    }
+
+    bool recording() const { return out != nullptr; }
+
+    // Vai para o buffer do FILE; o disco só é tocado a cada poucos KB
+    void record(const InputFrame& frame) {
+        if (!out) return;
+        if (std::fwrite(&frame, sizeof(frame), 1, out) == 1) ++frames;
+        else failed = true;
+    }
+
+    bool close() {
+        if (!out) return !failed;
+        bool ok = std::fclose(out) == 0 && !failed;
+        out = nullptr;
+        return ok;
+    }
+
+    uint64_t frames = 0;
+
+private:
+    std::FILE* out = nullptr;
+    bool failed = false;
+};
+
+struct InputReplay {
+    InputRecordingHeader header = {};
+    std::vector<InputFrame> frames;
+
+    // Lê o arquivo inteiro (40 bytes por quadro)
+    bool load(const char* path) {
+        std::FILE* in = std::fopen(path, "rb");
+        if (!in) {
+            std::cerr << "Failed to open input recording: " << path << std::endl;
+            return false;
+        }
+        bool ok = std::fread(&header, sizeof(header), 1, in) == 1 &&
+                  header.magic == INPUT_RECORDING_MAGIC && header.version == INPUT_RECORDING_VERSION;
+        if (!ok) {
+            std::cerr << "Not an input recording (or wrong version): " << path << std::endl;
+        } else {
+            InputFrame frame;
+            while (std::fread(&frame, sizeof(frame), 1, in) == 1) frames.push_back(frame);
+        }
+        std::fclose(in);
+        return ok && !frames.empty();
+    }
+
+    size_t size() const { return frames.size(); }
+};
+
+// Tempo de quadro de uma reprodução inteira
+class ReplayStats {
+public:
+    explicit ReplayStats(size_t frameCount) : frameTimes(std::max<size_t>(1, frameCount)) {}
+
+    void addFrame(double ms) {
+        frameTimes.add(ms);
+        totalMs += ms;
+        minMs = frameTimes.size() == 1 ? ms : std::min(minMs, ms);
+        maxMs = std::max(maxMs, ms);
+    }
+
+    // Tempo que o renderizador esperou a física alcançar o passo gravado
+    void addPhysicsWait(double ms) { waitMs += ms; }
+
+    std::string report() {
+        size_t n = frameTimes.size();
+        char text[320];
+        std::snprintf(text, sizeof(text),
+                      "replay: %zu frames in %.3f s (%.1f fps)\n"
+                      "frame ms  mean %.3f  min %.3f  p50 %.3f  p95 %.3f  p99 %.3f  max %.3f\n"
+                      "physics wait %.3f s\n",
+                      n, totalMs * 1e-3, n && totalMs > 0.0 ? n * 1e3 / totalMs : 0.0,
+                      n ? totalMs / n : 0.0, minMs, frameTimes.percentile(50), frameTimes.percentile(95),
+                      frameTimes.percentile(99), maxMs, waitMs * 1e-3);
+        return text;
+    }
+
+private:
+    RollingPercentiles frameTimes;  // Janela do tamanho da reprodução: guarda todos
+    double totalMs = 0.0, minMs = 0.0, maxMs = 0.0, waitMs = 0.0;
+};
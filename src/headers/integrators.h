@@ -0,0 +1,218 @@
+#pragma once
+
+#include "nbody.h"
+#include "gravity.h"
+#include "particles.h"
+#include "block_timestep.h"
+#include "wisdom_holman.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+
+// Integradores simpléticos escritos como composição de "kicks" (v += b·a·dt)
+// e "drifts" (x += a·v·dt), sempre começando por um kick:
+//   K(b0) D(a0) K(b1) D(a1) ... [K(bn)]
+// Quando o esquema termina num kick, a força do fim do passo é a mesma do
+// início do próximo (FSAL) e fica guardada no store, economizando uma avaliação.
+// O tipo Block usa passos individuais em blocos (block_timestep.h) e o
+// WisdomHolman separa o movimento kepleriano em torno do Sol (wisdom_holman.h).
+enum class IntegratorType { Euler, Leapfrog, Yoshida4, ForestRuth, Block, WisdomHolman };
+
+struct CompositionScheme {
+    const char* name;
+    int kicks;
+    int drifts;
+    double b[5];    // Coeficientes dos kicks
+    double a[4];    // Coeficientes dos drifts
+};
+
+// Yoshida (1990): leapfrog KDK composto em "triple jump" w1, w0, w1
+const double YOSHIDA_W1 = 1.0 / (2.0 - 1.2599210498948732);
+const double YOSHIDA_W0 = -1.2599210498948732 / (2.0 - 1.2599210498948732);
+
+// Forest–Ruth otimizado (PEFRL, Omelyan, Mryglod & Folk 2002), forma de velocidade
+const double FR_XI = 0.1786178958448091;
+const double FR_LAMBDA = -0.2123418310626054;
+const double FR_CHI = -0.06626458266981849;
+
+inline const CompositionScheme& compositionScheme(IntegratorType type) {
+    static const CompositionScheme euler = {
+        "euler", 1, 1, { 1.0 }, { 1.0 }
+    };
+    static const CompositionScheme leapfrog = {
+        "leapfrog", 2, 1, { 0.5, 0.5 }, { 1.0 }
+    };
+    static const CompositionScheme yoshida4 = {
+        "yoshida4", 4, 3,
+        { 0.5 * YOSHIDA_W1, 0.5 * (YOSHIDA_W1 + YOSHIDA_W0), 0.5 * (YOSHIDA_W0 + YOSHIDA_W1), 0.5 * YOSHIDA_W1 },
+        { YOSHIDA_W1, YOSHIDA_W0, YOSHIDA_W1 }
+    };
+    static const CompositionScheme forestRuth = {
+        "forest-ruth", 5, 4,
+        { FR_XI, FR_CHI, 1.0 - 2.0 * (FR_CHI + FR_XI), FR_CHI, FR_XI },
+        { 0.5 * (1.0 - 2.0 * FR_LAMBDA), FR_LAMBDA, FR_LAMBDA, 0.5 * (1.0 - 2.0 * FR_LAMBDA) }
+    };
+    switch (type) {
+        case IntegratorType::Euler:     return euler;
+        case IntegratorType::Yoshida4:  return yoshida4;
+        case IntegratorType::ForestRuth: return forestRuth;
+        default:                        return leapfrog;
+    }
+}
+
+inline const char* integratorName(IntegratorType type) {
+    if (type == IntegratorType::Block) return "block";
+    if (type == IntegratorType::WisdomHolman) return "wh";
+    return compositionScheme(type).name;
+}
+
+inline bool parseIntegrator(const char* name, IntegratorType& out) {
+    for (IntegratorType t : { IntegratorType::Euler, IntegratorType::Leapfrog,
+                              IntegratorType::Yoshida4, IntegratorType::ForestRuth,
+                              IntegratorType::Block, IntegratorType::WisdomHolman }) {
+        if (std::strcmp(name, integratorName(t)) == 0) { out = t; return true; }
+    }
+    return false;
+}
+
+inline void kick(BodyStore& s, double h) {
+    for (size_t i = 0; i < s.count; ++i) {
+        s.vx[i] += s.ax[i] * h;
+        s.vy[i] += s.ay[i] * h;
+        s.vz[i] += s.az[i] * h;
+    }
+}
+
+inline void drift(BodyStore& s, double h) {
+    for (size_t i = 0; i < s.count; ++i) {
+        if (s.pinned[i]) continue;
+        s.x[i] += s.vx[i] * h;
+        s.y[i] += s.vy[i] * h;
+        s.z[i] += s.vz[i] * h;
+    }
+}
+
+struct Integrator {
+    IntegratorType type = IntegratorType::Leapfrog;
+    bool forcesValid = false;           // ax/ay/az do store correspondem às posições atuais
+    bool particleForcesValid = false;   // Idem para as partículas de teste
+    MassiveStages stages;
+    BlockTimesteps block;
+    WisdomHolman wh;
+
+    // Deve ser chamado sempre que posições ou massas mudam fora do integrador
+    void invalidate() {
+        forcesValid = false;
+        particleForcesValid = false;
+        block.invalidate();
+        wh.invalidate();
+    }
+
+    // Composições que terminam num kick avaliam a força (e o potencial, com
+    // computePotential) nas posições finais do passo
+    bool endsWithForces() const {
+        if (type == IntegratorType::Block || type == IntegratorType::WisdomHolman) return false;
+        const CompositionScheme& scheme = compositionScheme(type);
+        return scheme.kicks > scheme.drifts;
+    }
+
+    // Força nas posições atuais, reaproveitada pelo primeiro kick do próximo passo
+    void evaluateForces(BodyStore& s, GravitySolver& solver) {
+        solver.computeAccelerations(s);
+        forcesValid = true;
+    }
+
+    void step(BodyStore& s, GravitySolver& solver, double dt, ParticleStore* particles = nullptr) {
+        bool withParticles = particles && particles->count > 0;
+        if (type == IntegratorType::Block) {
+            stepBlock(s, solver, dt, withParticles ? particles : nullptr);
+            return;
+        }
+        if (type == IntegratorType::WisdomHolman) {
+            // As acelerações do WH são só de interação; as da composição não servem
+            if (wh.step(s, solver, dt, withParticles ? particles : nullptr, stages)) {
+                forcesValid = false;
+                particleForcesValid = false;
+                return;
+            }
+            type = IntegratorType::Leapfrog;
+        }
+
+        const CompositionScheme& scheme = compositionScheme(type);
+        if (withParticles) stages.begin(s, scheme.kicks);
+
+        for (int k = 0; k < scheme.kicks; ++k) {
+            if (!forcesValid) {
+                solver.computeAccelerations(s);
+                forcesValid = true;
+            }
+            if (withParticles) stages.record(s, k);
+            kick(s, scheme.b[k] * dt);
+            if (k < scheme.drifts) {
+                drift(s, scheme.a[k] * dt);
+                forcesValid = false;
+            }
+        }
+
+        if (withParticles) stepParticles(*particles, scheme, dt, solver.pool);
+    }
+
+    // Passos em blocos para os corpos massivos (sempre soma direta). As
+    // partículas seguem com leapfrog no passo global, usando as posições
+    // massivas sincronizadas do início e do fim do passo.
+    void stepBlock(BodyStore& s, GravitySolver& solver, double dt, ParticleStore* particles) {
+        if (particles) {
+            stages.begin(s, 2);
+            stages.record(s, 0);
+        }
+        block.step(s, solver.pool, dt);
+        forcesValid = false;
+        if (particles) {
+            stages.record(s, 1);
+            stepParticles(*particles, compositionScheme(IntegratorType::Leapfrog), dt, solver.pool);
+        }
+    }
+
+    // As partículas não afetam os corpos massivos, então com as posições de
+    // cada estágio já gravadas cada bloco de partículas faz o passo inteiro
+    // (todas as forças, kicks e drifts) enquanto ainda está no cache.
+    void stepParticles(ParticleStore& p, const CompositionScheme& scheme, double dt, ThreadPool* pool) {
+        ParticleKernel kernel = activeParticleKernel();
+        const bool reuse = particleForcesValid;
+        const size_t n = stages.n;
+
+        auto chunk = [&](size_t b, size_t e) {
+            for (int k = 0; k < scheme.kicks; ++k) {
+                if (k > 0 || !reuse) {
+                    kernel(p, b, e, &stages.x[k * n], &stages.y[k * n], &stages.z[k * n], stages.gm.data(), n);
+                }
+                double h = scheme.b[k] * dt;
+                for (size_t i = b; i < e; ++i) {
+                    p.vx[i] += p.ax[i] * h;
+                    p.vy[i] += p.ay[i] * h;
+                    p.vz[i] += p.az[i] * h;
+                }
+                if (k < scheme.drifts) {
+                    double d = scheme.a[k] * dt;
+                    for (size_t i = b; i < e; ++i) {
+                        p.x[i] += p.vx[i] * d;
+                        p.y[i] += p.vy[i] * d;
+                        p.z[i] += p.vz[i] * d;
+                    }
+                }
+            }
+        };
+
+        if (pool && pool->threadCount() > 1) {
+            // Blocos múltiplos de NBODY_PAD para os kernels SIMD
+            size_t grain = std::max<size_t>(1024, p.count / (pool->threadCount() * 8));
+            grain = (grain + NBODY_PAD - 1) / NBODY_PAD * NBODY_PAD;
+            pool->parallelFor(0, p.count, grain, chunk);
+        } else {
+            chunk(0, p.count);
+        }
+        particleForcesValid = scheme.kicks > scheme.drifts;
+    }
+};
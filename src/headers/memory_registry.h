@@ -0,0 +1,177 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+// Contabilidade da memória de GPU e de host, sem dependência de OpenGL: cada
+// recurso (buffer, textura ou renderbuffer do GL, ou bloco do host) é
+// registrado com categoria, rótulo e tamanho em bytes, e opcionalmente com os
+// astros donos (uma textura array é dividida igualmente entre as camadas).
+// Os recursos de GL passam pelos wrappers de gpu_memory.h. O que ainda estiver
+// registrado na saída é relatado como vazamento por reportLeaks.
+// Os tamanhos são os pedidos ao driver, que pode alinhar ou expandir
+// formatos (RGB8 costuma ocupar 4 bytes por texel).
+enum class MemoryCategory { Texture, Mesh, Dynamic, Target, Host };
+const int MEMORY_CATEGORIES = 5;
+
+inline const char* memoryCategoryName(MemoryCategory category) {
+    switch (category) {
+        case MemoryCategory::Texture: return "textures";
+        case MemoryCategory::Mesh:    return "meshes";
+        case MemoryCategory::Dynamic: return "dynamic buffers";
+        case MemoryCategory::Target:  return "render targets";
+        default:                      return "host";
+    }
+}
+
+enum class MemoryObject { Buffer, Texture, Renderbuffer, Host };
+
+inline const char* memoryObjectName(MemoryObject kind) {
+    switch (kind) {
+        case MemoryObject::Buffer:       return "buffer";
+        case MemoryObject::Texture:      return "texture";
+        case MemoryObject::Renderbuffer: return "renderbuffer";
+        default:                         return "host block";
+    }
+}
+
+// Nome curto de um astro pelo arquivo de textura: "textures/2k_earth.jpg" -> "2k_earth"
+inline std::string memoryOwnerName(const char* file) {
+    std::string name = file ? file : "";
+    size_t slash = name.find_last_of("/\\");
+    if (slash != std::string::npos) name.erase(0, slash + 1);
+    size_t dot = name.find_last_of('.');
+    if (dot != std::string::npos && dot > 0) name.erase(dot);
+    return name;
+}
+
+inline std::string formatBytes(size_t bytes) {
+    char text[32];
+    if (bytes >= (1u << 20)) std::snprintf(text, sizeof(text), "%.1f MB", bytes / 1048576.0);
+    else if (bytes >= (1u << 10)) std::snprintf(text, sizeof(text), "%.1f KB", bytes / 1024.0);
+    else std::snprintf(text, sizeof(text), "%zu B", bytes);
+    return text;
+}
+
+class MemoryRegistry {
+public:
+    static MemoryRegistry& instance() {
+        static MemoryRegistry registry;
+        return registry;
+    }
+
+    // id: nome do objeto GL, ou o endereço do bloco para MemoryObject::Host
+    void add(MemoryObject kind, uintptr_t id, MemoryCategory category, const std::string& label, size_t bytes = 0) {
+        std::lock_guard<std::mutex> lock(mutex);
+        Entry& entry = entries[Key(kind, id)];
+        totals[static_cast<int>(entry.category)] -= entry.bytes;
+        entry.category = category;
+        entry.label = label;
+        entry.bytes = bytes;
+        entry.owners.clear();
+        totals[static_cast<int>(category)] += bytes;
+    }
+
+    void setBytes(MemoryObject kind, uintptr_t id, size_t bytes) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(Key(kind, id));
+        if (it == entries.end()) return;
+        totals[static_cast<int>(it->second.category)] += bytes - it->second.bytes;
+        it->second.bytes = bytes;
+    }
+
+    void setOwners(MemoryObject kind, uintptr_t id, const std::vector<std::string>& owners) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(Key(kind, id));
+        if (it != entries.end()) it->second.owners = owners;
+    }
+
+    void remove(MemoryObject kind, uintptr_t id) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(Key(kind, id));
+        if (it == entries.end()) return;
+        totals[static_cast<int>(it->second.category)] -= it->second.bytes;
+        entries.erase(it);
+    }
+
+    size_t total(MemoryCategory category) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return totals[static_cast<int>(category)];
+    }
+
+    size_t gpuTotal() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t sum = 0;
+        for (int c = 0; c < MEMORY_CATEGORIES; ++c) {
+            if (c != static_cast<int>(MemoryCategory::Host)) sum += totals[c];
+        }
+        return sum;
+    }
+
+    // Uma linha (título da janela)
+    std::string summary() const {
+        return "GPU " + formatBytes(gpuTotal()) + ", host " + formatBytes(total(MemoryCategory::Host));
+    }
+
+    // Totais por categoria e por astro dono, maiores primeiro
+    std::string report() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::string text = "memory\n";
+        char line[160];
+        for (int c = 0; c < MEMORY_CATEGORIES; ++c) {
+            size_t count = 0;
+            for (const auto& e : entries) count += static_cast<int>(e.second.category) == c;
+            std::snprintf(line, sizeof(line), "  %-16s %10s  (%zu objects)\n",
+                          memoryCategoryName(static_cast<MemoryCategory>(c)), formatBytes(totals[c]).c_str(), count);
+            text += line;
+        }
+
+        std::map<std::string, size_t> owners;
+        for (const auto& e : entries) {
+            const Entry& entry = e.second;
+            for (const std::string& owner : entry.owners) owners[owner] += entry.bytes / entry.owners.size();
+        }
+        std::vector<std::pair<std::string, size_t>> sorted(owners.begin(), owners.end());
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const std::pair<std::string, size_t>& a, const std::pair<std::string, size_t>& b) {
+                      return a.second > b.second;
+                  });
+        if (!sorted.empty()) text += "  by body\n";
+        for (const auto& owner : sorted) {
+            std::snprintf(line, sizeof(line), "    %-14s %10s\n", owner.first.c_str(), formatBytes(owner.second).c_str());
+            text += line;
+        }
+        return text;
+    }
+
+    // Lista no stderr o que não foi liberado; retorna quantos
+    size_t reportLeaks() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& e : entries) {
+            std::cerr << "Leaked " << memoryObjectName(e.first.first) << " '" << e.second.label << "' ("
+                      << memoryCategoryName(e.second.category) << ", " << formatBytes(e.second.bytes) << ")" << std::endl;
+        }
+        return entries.size();
+    }
+
+private:
+    typedef std::pair<MemoryObject, uintptr_t> Key;
+    struct Entry {
+        MemoryCategory category = MemoryCategory::Host;
+        std::string label;
+        size_t bytes = 0;
+        std::vector<std::string> owners;    // Astros que dividem o recurso (vazio = compartilhado)
+    };
+
+    mutable std::mutex mutex;   // Blocos do host podem vir de outras threads
+    std::map<Key, Entry> entries;
+    size_t totals[MEMORY_CATEGORIES] = {};
+};
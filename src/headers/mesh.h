@@ -0,0 +1,94 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+#include <cmath>
+#include <vector>
+
+
+// Geração das malhas dos astros e dos anéis, sem dependência de OpenGL
+// (os VBOs são criados por quem chama)
+
+// Esfera unitária indexada, compartilhada por todos os astros (o raio vem por
+// instância). Grade (stacks + 1) × (sectors + 1) com a costura duplicada para
+// as coordenadas de textura; cada vértice tem posição, textura e normal
+// (8 floats), e a normal de uma esfera unitária é a própria posição.
+inline void createSphereMesh(int stacks, int sectors, std::vector<float>& vertices, std::vector<unsigned>& indices) {
+    const float PI = glm::pi<float>();
+    vertices.clear();
+    indices.clear();
+    vertices.reserve(static_cast<size_t>(stacks + 1) * (sectors + 1) * 8);
+    indices.reserve(static_cast<size_t>(stacks) * sectors * 6);
+
+    for (int i = 0; i <= stacks; ++i) {
+        float theta = i * PI / stacks;
+        for (int j = 0; j <= sectors; ++j) {
+            float phi = j * 2 * PI / sectors;
+            glm::vec3 pos(sin(theta) * cos(phi), cos(theta), sin(theta) * sin(phi));
+            // Coordenadas de textura
+            float u = phi / (2 * PI);
+            float v = 1.0f - theta / PI;
+
+            vertices.push_back(pos.x);
+            vertices.push_back(pos.y);
+            vertices.push_back(pos.z);
+            vertices.push_back(u);
+            vertices.push_back(v);
+            vertices.push_back(pos.x);
+            vertices.push_back(pos.y);
+            vertices.push_back(pos.z);
+        }
+    }
+
+    for (int i = 0; i < stacks; ++i) {
+        for (int j = 0; j < sectors; ++j) {
+            unsigned current = i * (sectors + 1) + j;
+            unsigned next = current + sectors + 1;
+
+            // Triangle 1
+            indices.push_back(current);
+            indices.push_back(current + 1);
+            indices.push_back(next);
+
+            // Triangle 2
+            indices.push_back(current + 1);
+            indices.push_back(next + 1);
+            indices.push_back(next);
+        }
+    }
+}
+
+// Anel plano (coroa circular) indexado, compartilhado por todos os anéis: cada
+// vértice tem a direção (cos, sin) no plano XY e a borda (0 = interna,
+// 1 = externa); os raios e a textura radial são aplicados no shader
+inline void createRingMesh(int segments, std::vector<float>& vertices, std::vector<unsigned>& indices) {
+    const float TAU = 2.0f * glm::pi<float>();
+    vertices.clear();
+    indices.clear();
+    vertices.reserve(static_cast<size_t>(segments + 1) * 2 * 3);
+    indices.reserve(static_cast<size_t>(segments) * 6);
+
+    for (int i = 0; i <= segments; ++i) {
+        float angle = i * TAU / segments;
+        for (int edge = 0; edge < 2; ++edge) {
+            vertices.push_back(cos(angle));
+            vertices.push_back(sin(angle));
+            vertices.push_back(static_cast<float>(edge));
+        }
+    }
+
+    for (int i = 0; i < segments; ++i) {
+        unsigned inner = 2 * i, outer = inner + 1;
+        unsigned nextInner = inner + 2, nextOuter = inner + 3;
+
+        // Triângulo 1
+        indices.push_back(inner);
+        indices.push_back(outer);
+        indices.push_back(nextInner);
+
+        // Triângulo 2
+        indices.push_back(nextInner);
+        indices.push_back(outer);
+        indices.push_back(nextOuter);
+    }
+}
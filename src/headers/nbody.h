@@ -0,0 +1,332 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <cmath>
+#include <new>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define NBODY_X86 1
+#endif
+
+
+// Armazenamento da física em estrutura de arrays (SoA), separado dos dados de
+// renderização (VAO, VBO, textura). Cada array é alinhado em 64 bytes e tem
+// tamanho múltiplo de NBODY_PAD, então os kernels SIMD nunca precisam de laço
+// de resto: as posições extras têm GM = 0 e não contribuem para a soma.
+const size_t NBODY_ALIGN = 64;
+const size_t NBODY_PAD = 8;     // 8 doubles = um registrador AVX-512
+
+// Alocador alinhado para std::vector
+template <typename T>
+struct AlignedAllocator {
+    typedef T value_type;
+
+    AlignedAllocator() = default;
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U>&) {}
+
+    // Pelo operator new alinhado, para que substituições dele (o contador de
+    // alocações do main_bench.cpp) vejam estes blocos
+    T* allocate(size_t n) {
+        size_t bytes = (n * sizeof(T) + NBODY_ALIGN - 1) / NBODY_ALIGN * NBODY_ALIGN;
+        return static_cast<T*>(::operator new(bytes, std::align_val_t(NBODY_ALIGN)));
+    }
+    void deallocate(T* p, size_t) { ::operator delete(p, std::align_val_t(NBODY_ALIGN)); }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U>&) const { return true; }
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U>&) const { return false; }
+};
+
+typedef std::vector<double, AlignedAllocator<double>> DoubleArray;
+
+struct BodyStore {
+    size_t count = 0;       // Número de corpos reais
+    size_t padded = 0;      // count arredondado para múltiplo de NBODY_PAD
+
+    DoubleArray x, y, z;        // Posição (m)
+    DoubleArray vx, vy, vz;     // Velocidade (m/s)
+    DoubleArray gm;             // G * massa (m³/s²)
+    DoubleArray ax, ay, az;     // Aceleração calculada no último passo
+    DoubleArray pot;            // Potencial −Σ GMj/r (m²/s²), só com computePotential
+    std::vector<unsigned char> pinned;  // Corpos fixos (Sol)
+
+    // Pede aos kernels o potencial junto com a aceleração, reaproveitando as
+    // distâncias do mesmo laço; corpos fixos ficam com pot = 0
+    bool computePotential = false;
+
+    void resize(size_t n) {
+        count = n;
+        padded = (n + NBODY_PAD - 1) / NBODY_PAD * NBODY_PAD;
+        for (DoubleArray* a : { &x, &y, &z, &vx, &vy, &vz, &gm, &ax, &ay, &az, &pot }) {
+            a->assign(padded, 0.0);
+        }
+        pinned.assign(padded, 0);
+    }
+};
+
+// Calcula a aceleração dos corpos i em [begin, end) devido a todos os corpos
+// do store, escrevendo em ax/ay/az[i] (e pot[i] com computePotential). Cada i
+// escreve só no seu próprio slot.
+typedef void (*GravityKernel)(BodyStore& s, size_t begin, size_t end);
+
+enum class SimdLevel { Scalar, AVX2, AVX512 };
+
+inline const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX512: return "avx512";
+        case SimdLevel::AVX2:   return "avx2";
+        default:                return "scalar";
+    }
+}
+
+// Kernel escalar (fallback). Pares com r² = 0 (o próprio corpo) são ignorados.
+template <bool Potential>
+inline void gravityKernelScalarImpl(BodyStore& s, size_t begin, size_t end) {
+    const double* x = s.x.data();
+    const double* y = s.y.data();
+    const double* z = s.z.data();
+    const double* gm = s.gm.data();
+
+    for (size_t i = begin; i < end; ++i) {
+        double axi = 0.0, ayi = 0.0, azi = 0.0, poti = 0.0;
+        if (!s.pinned[i]) {
+            const double xi = x[i], yi = y[i], zi = z[i];
+            for (size_t j = 0; j < s.count; ++j) {
+                double dx = x[j] - xi;
+                double dy = y[j] - yi;
+                double dz = z[j] - zi;
+                double r2 = dx * dx + dy * dy + dz * dz;
+                if (r2 == 0.0) continue;
+                double r = std::sqrt(r2);
+                double f = gm[j] / (r2 * r);
+                axi += dx * f;
+                ayi += dy * f;
+                azi += dz * f;
+                if (Potential) poti -= gm[j] / r;
+            }
+        }
+        s.ax[i] = axi;
+        s.ay[i] = ayi;
+        s.az[i] = azi;
+        if (Potential) s.pot[i] = poti;
+    }
+}
+
+inline void gravityKernelScalar(BodyStore& s, size_t begin, size_t end) {
+    if (s.computePotential) gravityKernelScalarImpl<true>(s, begin, end);
+    else gravityKernelScalarImpl<false>(s, begin, end);
+}
+
+#ifdef NBODY_X86
+
+// Passo de 4 pares (j..j+3) para um corpo i no kernel AVX2
+template <bool Potential>
+__attribute__((target("avx2,fma"), always_inline))
+inline void accumulateAVX2(__m256d xj, __m256d yj, __m256d zj, __m256d gmj,
+                           __m256d xi, __m256d yi, __m256d zi,
+                           __m256d& axv, __m256d& ayv, __m256d& azv, __m256d& potv) {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d halfv = _mm256_set1_pd(0.5);
+    const __m256d threeHalves = _mm256_set1_pd(1.5);
+
+    __m256d dx = _mm256_sub_pd(xj, xi);
+    __m256d dy = _mm256_sub_pd(yj, yi);
+    __m256d dz = _mm256_sub_pd(zj, zi);
+    __m256d r2 = _mm256_fmadd_pd(dx, dx, _mm256_fmadd_pd(dy, dy, _mm256_mul_pd(dz, dz)));
+    __m256d mask = _mm256_cmp_pd(r2, zero, _CMP_GT_OQ);
+    // 1/sqrt(r²): estimativa de 12 bits em float + 2 iterações de Newton.
+    // A conversão para float limita r² a ~3e38 m², muito além do sistema solar.
+    __m256d inv = _mm256_cvtps_pd(_mm_rsqrt_ps(_mm256_cvtpd_ps(r2)));
+    __m256d hr2 = _mm256_mul_pd(halfv, r2);
+    inv = _mm256_mul_pd(inv, _mm256_fnmadd_pd(hr2, _mm256_mul_pd(inv, inv), threeHalves));
+    inv = _mm256_mul_pd(inv, _mm256_fnmadd_pd(hr2, _mm256_mul_pd(inv, inv), threeHalves));
+    __m256d inv3 = _mm256_mul_pd(inv, _mm256_mul_pd(inv, inv));
+    __m256d f = _mm256_and_pd(mask, _mm256_mul_pd(gmj, inv3));
+    axv = _mm256_fmadd_pd(dx, f, axv);
+    ayv = _mm256_fmadd_pd(dy, f, ayv);
+    azv = _mm256_fmadd_pd(dz, f, azv);
+    if (Potential) potv = _mm256_sub_pd(potv, _mm256_and_pd(mask, _mm256_mul_pd(gmj, inv)));
+}
+
+__attribute__((target("avx2,fma")))
+inline double horizontalSumAVX2(__m256d v) {
+    __m128d lo = _mm256_castpd256_pd128(v);
+    __m128d hi = _mm256_extractf128_pd(v, 1);
+    lo = _mm_add_pd(lo, hi);
+    return _mm_cvtsd_f64(_mm_add_sd(lo, _mm_unpackhi_pd(lo, lo)));
+}
+
+// Kernel AVX2 + FMA: 4 interações por instrução. Dois corpos i são tratados
+// por vez para reaproveitar as cargas de j e intercalar as cadeias de dependência.
+template <bool Potential>
+__attribute__((target("avx2,fma")))
+inline void gravityKernelAVX2Impl(BodyStore& s, size_t begin, size_t end) {
+    const double* x = s.x.data();
+    const double* y = s.y.data();
+    const double* z = s.z.data();
+    const double* gm = s.gm.data();
+
+    size_t i = begin;
+    while (i < end) {
+        // Corpos fixos são pulados individualmente
+        if (s.pinned[i]) {
+            s.ax[i] = s.ay[i] = s.az[i] = 0.0;
+            if (Potential) s.pot[i] = 0.0;
+            ++i;
+            continue;
+        }
+        size_t k = i + 1;
+        bool pair = k < end && !s.pinned[k];
+        if (!pair) k = i;
+
+        const __m256d xi = _mm256_set1_pd(x[i]), xk = _mm256_set1_pd(x[k]);
+        const __m256d yi = _mm256_set1_pd(y[i]), yk = _mm256_set1_pd(y[k]);
+        const __m256d zi = _mm256_set1_pd(z[i]), zk = _mm256_set1_pd(z[k]);
+        __m256d axi = _mm256_setzero_pd(), ayi = axi, azi = axi;
+        __m256d axk = axi, ayk = axi, azk = axi;
+        __m256d poti = axi, potk = axi;
+
+        for (size_t j = 0; j < s.padded; j += 4) {
+            __m256d xj = _mm256_load_pd(x + j);
+            __m256d yj = _mm256_load_pd(y + j);
+            __m256d zj = _mm256_load_pd(z + j);
+            __m256d gmj = _mm256_load_pd(gm + j);
+            accumulateAVX2<Potential>(xj, yj, zj, gmj, xi, yi, zi, axi, ayi, azi, poti);
+            accumulateAVX2<Potential>(xj, yj, zj, gmj, xk, yk, zk, axk, ayk, azk, potk);
+        }
+
+        s.ax[i] = horizontalSumAVX2(axi);
+        s.ay[i] = horizontalSumAVX2(ayi);
+        s.az[i] = horizontalSumAVX2(azi);
+        if (Potential) s.pot[i] = horizontalSumAVX2(poti);
+        if (pair) {
+            s.ax[k] = horizontalSumAVX2(axk);
+            s.ay[k] = horizontalSumAVX2(ayk);
+            s.az[k] = horizontalSumAVX2(azk);
+            if (Potential) s.pot[k] = horizontalSumAVX2(potk);
+            i += 2;
+        } else {
+            i += 1;
+        }
+    }
+}
+
+__attribute__((target("avx2,fma")))
+inline void gravityKernelAVX2(BodyStore& s, size_t begin, size_t end) {
+    if (s.computePotential) gravityKernelAVX2Impl<true>(s, begin, end);
+    else gravityKernelAVX2Impl<false>(s, begin, end);
+}
+
+// Kernel AVX-512: 8 interações por instrução
+template <bool Potential>
+__attribute__((target("avx512f")))
+inline void gravityKernelAVX512Impl(BodyStore& s, size_t begin, size_t end) {
+    const double* x = s.x.data();
+    const double* y = s.y.data();
+    const double* z = s.z.data();
+    const double* gm = s.gm.data();
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d halfv = _mm512_set1_pd(0.5);
+    const __m512d threeHalves = _mm512_set1_pd(1.5);
+
+    for (size_t i = begin; i < end; ++i) {
+        if (s.pinned[i]) {
+            s.ax[i] = s.ay[i] = s.az[i] = 0.0;
+            if (Potential) s.pot[i] = 0.0;
+            continue;
+        }
+        const __m512d xi = _mm512_set1_pd(x[i]);
+        const __m512d yi = _mm512_set1_pd(y[i]);
+        const __m512d zi = _mm512_set1_pd(z[i]);
+        __m512d axv = zero, ayv = zero, azv = zero, potv = zero;
+
+        for (size_t j = 0; j < s.padded; j += 8) {
+            __m512d dx = _mm512_sub_pd(_mm512_load_pd(x + j), xi);
+            __m512d dy = _mm512_sub_pd(_mm512_load_pd(y + j), yi);
+            __m512d dz = _mm512_sub_pd(_mm512_load_pd(z + j), zi);
+            __m512d r2 = _mm512_fmadd_pd(dx, dx, _mm512_fmadd_pd(dy, dy, _mm512_mul_pd(dz, dz)));
+            __mmask8 mask = _mm512_cmp_pd_mask(r2, zero, _CMP_GT_OQ);
+            // 1/sqrt(r²): estimativa de 14 bits + 2 iterações de Newton
+            __m512d inv = _mm512_rsqrt14_pd(r2);
+            inv = _mm512_mul_pd(inv, _mm512_fnmadd_pd(_mm512_mul_pd(halfv, r2), _mm512_mul_pd(inv, inv), threeHalves));
+            inv = _mm512_mul_pd(inv, _mm512_fnmadd_pd(_mm512_mul_pd(halfv, r2), _mm512_mul_pd(inv, inv), threeHalves));
+            __m512d inv3 = _mm512_mul_pd(inv, _mm512_mul_pd(inv, inv));
+            __m512d gmj = _mm512_load_pd(gm + j);
+            __m512d f = _mm512_maskz_mul_pd(mask, gmj, inv3);
+            axv = _mm512_fmadd_pd(dx, f, axv);
+            ayv = _mm512_fmadd_pd(dy, f, ayv);
+            azv = _mm512_fmadd_pd(dz, f, azv);
+            if (Potential) potv = _mm512_sub_pd(potv, _mm512_maskz_mul_pd(mask, gmj, inv));
+        }
+
+        s.ax[i] = _mm512_reduce_add_pd(axv);
+        s.ay[i] = _mm512_reduce_add_pd(ayv);
+        s.az[i] = _mm512_reduce_add_pd(azv);
+        if (Potential) s.pot[i] = _mm512_reduce_add_pd(potv);
+    }
+}
+
+__attribute__((target("avx512f")))
+inline void gravityKernelAVX512(BodyStore& s, size_t begin, size_t end) {
+    if (s.computePotential) gravityKernelAVX512Impl<true>(s, begin, end);
+    else gravityKernelAVX512Impl<false>(s, begin, end);
+}
+
+#endif
+
+// Detecção do conjunto de instruções em tempo de execução
+inline SimdLevel detectSimdLevel() {
+#ifdef NBODY_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return SimdLevel::AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return SimdLevel::AVX2;
+#endif
+    return SimdLevel::Scalar;
+}
+
+inline GravityKernel gravityKernelFor(SimdLevel level) {
+#ifdef NBODY_X86
+    if (level == SimdLevel::AVX512) return gravityKernelAVX512;
+    if (level == SimdLevel::AVX2) return gravityKernelAVX2;
+#endif
+    return gravityKernelScalar;
+}
+
+// Kernel escolhido uma única vez, na primeira chamada
+inline GravityKernel activeGravityKernel() {
+    static const GravityKernel kernel = gravityKernelFor(detectSimdLevel());
+    return kernel;
+}
+
+// Cópia entre o vetor de astros (position/velocity/mass/isSun) e o store SoA
+template <typename Body>
+void loadBodyStore(BodyStore& s, const std::vector<Body>& bodies, double G) {
+    s.resize(bodies.size());
+    for (size_t i = 0; i < bodies.size(); ++i) {
+        s.x[i] = bodies[i].position.x;
+        s.y[i] = bodies[i].position.y;
+        s.z[i] = bodies[i].position.z;
+        s.vx[i] = bodies[i].velocity.x;
+        s.vy[i] = bodies[i].velocity.y;
+        s.vz[i] = bodies[i].velocity.z;
+        s.gm[i] = G * bodies[i].mass;
+        s.pinned[i] = bodies[i].isSun;
+    }
+}
+
+template <typename Body>
+void storeBodyStore(const BodyStore& s, std::vector<Body>& bodies) {
+    for (size_t i = 0; i < bodies.size() && i < s.count; ++i) {
+        bodies[i].position.x = s.x[i];
+        bodies[i].position.y = s.y[i];
+        bodies[i].position.z = s.z[i];
+        bodies[i].velocity.x = s.vx[i];
+        bodies[i].velocity.y = s.vy[i];
+        bodies[i].velocity.z = s.vz[i];
+    }
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "libs.h"
+#include "gpu_memory.h"
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <cstring>
+
+
+// Contexto OpenGL 3.3 core sem janela nem display (EGL surfaceless), para
+// renderizar em servidores sem X/Wayland; com Mesa roda até no llvmpipe.
+// Como não há superfície, tudo é desenhado num framebuffer próprio
+// (OffscreenTarget). Usa a plataforma EGL_MESA_platform_surfaceless quando
+// existe, senão o display padrão com EGL_KHR_surfaceless_context.
+struct OffscreenContext {
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLContext context = EGL_NO_CONTEXT;
+
+    bool init() {
+        const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+        if (clientExtensions && std::strstr(clientExtensions, "EGL_MESA_platform_surfaceless")) {
+            PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+                (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+            if (getPlatformDisplay) display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        }
+        if (display == EGL_NO_DISPLAY) display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        if (display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr)) {
+            std::cerr << "Failed to initialize EGL" << std::endl;
+            return false;
+        }
+        if (!eglBindAPI(EGL_OPENGL_API)) {
+            std::cerr << "EGL has no desktop OpenGL" << std::endl;
+            return false;
+        }
+
+        // Sem superfície: qualquer config serve (o padrão pediria EGL_WINDOW_BIT)
+        const EGLint configAttribs[] = { EGL_SURFACE_TYPE, 0, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+        EGLConfig config;
+        EGLint configCount = 0;
+        if (!eglChooseConfig(display, configAttribs, &config, 1, &configCount) || configCount == 0) {
+            std::cerr << "No EGL config for OpenGL" << std::endl;
+            return false;
+        }
+
+        const EGLint contextAttribs[] = {
+            EGL_CONTEXT_MAJOR_VERSION, 3,
+            EGL_CONTEXT_MINOR_VERSION, 3,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+        context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+        if (context == EGL_NO_CONTEXT || !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+            std::cerr << "Failed to create surfaceless EGL context" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    void destroy() {
+        if (display == EGL_NO_DISPLAY) return;
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (context != EGL_NO_CONTEXT) eglDestroyContext(display, context);
+        eglTerminate(display);
+        display = EGL_NO_DISPLAY;
+        context = EGL_NO_CONTEXT;
+    }
+};
+
+// Framebuffer de cor RGBA8 + profundidade no tamanho pedido, ligado como
+// destino de desenho e de leitura
+struct OffscreenTarget {
+    GLuint FBO = 0, colorBuffer = 0, depthBuffer = 0;
+    int width = 0, height = 0;
+
+    bool init(int targetWidth, int targetHeight) {
+        width = targetWidth;
+        height = targetHeight;
+        glGenFramebuffers(1, &FBO);
+        colorBuffer = genTrackedRenderbuffer("offscreen color");
+        depthBuffer = genTrackedRenderbuffer("offscreen depth");
+
+        glBindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+        trackedRenderbufferStorage(colorBuffer, GL_RGBA8, width, height, 4);
+        glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
+        trackedRenderbufferStorage(depthBuffer, GL_DEPTH_COMPONENT24, width, height, 4);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            std::cerr << "Offscreen framebuffer incomplete" << std::endl;
+            return false;
+        }
+        glViewport(0, 0, width, height);
+        return true;
+    }
+
+    void destroy() {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteFramebuffers(1, &FBO);
+        deleteTrackedRenderbuffer(colorBuffer);
+        deleteTrackedRenderbuffer(depthBuffer);
+    }
+};
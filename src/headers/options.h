@@ -0,0 +1,169 @@
+#pragma once
+
+#include "simulation.h"
+#include "solar_system.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+
+// Opções de linha de comando no formato --nome=valor
+struct SimOptions {
+    ForceBackend backend = ForceBackend::Direct;
+    double theta = 0.5;
+    IntegratorType integrator = IntegratorType::Leapfrog;
+    double dt = 0.0;    // 0 = passo padrão do executável
+    unsigned threads = ThreadPool::defaultThreadCount();
+    double stepsPerSecond = 60.0;   // 0 = sem limite
+    size_t asteroids = 0;           // Partículas de teste no cinturão principal
+    size_t kuiper = 0;              // Partículas de teste no cinturão de Kuiper
+    int blockLevels = 8;            // Níveis do integrador em blocos
+    double blockEta = 0.02;
+    RadiusScale radiusScale = RadiusScale::Real;    // Só nos executáveis com janela
+    int trailLength = 256;          // Pontos por rastro de órbita (0 = sem rastros)
+    size_t trailParticles = 0;      // Partículas de teste que também deixam rastro
+    int width = 1280, height = 720; // Tamanho da janela ou do quadro offscreen
+    bool profile = false;           // Zonas de CPU, tempos de GPU e percentis do quadro
+    const char* trace = nullptr;    // Trace do Chrome/Perfetto gravado na saída (ou com T)
+    uint64_t monitorEvery = 0;      // Passos entre amostras de energia/momento angular (0 = desligado)
+    const char* record = nullptr;   // Grava entrada e câmera de cada quadro
+    const char* replay = nullptr;   // Reproduz uma gravação sem limite de quadros por segundo
+
+    // Só no modo offscreen (sem janela, contexto EGL)
+    bool offscreen = false;
+    uint64_t frames = 300;          // Quadros a renderizar
+    const char* frameDir = "frames";    // Pasta da sequência de imagens
+
+    // Só no executável headless
+    uint64_t steps = 0;             // Passos a integrar
+    double duration = 0.0;          // Ou tempo simulado, em segundos
+    const char* output = nullptr;   // Arquivo CSV do estado final (nullptr = stdout)
+    double maxDrift = 0.0;          // Desvio relativo de conservação que aborta (0 = nunca)
+};
+
+inline void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --solver=direct|bh   gravity backend (B toggles at runtime)\n"
+              << "  --theta=<value>      Barnes-Hut opening angle (default 0.5)\n"
+              << "  --integrator=<name>  euler|leapfrog|yoshida4|forest-ruth|block|wh (default leapfrog)\n"
+              << "  --block-levels=<n>   block timesteps: finest step is dt / 2^n (default 8)\n"
+              << "  --block-eta=<value>  block timesteps: accuracy parameter (default 0.02)\n"
+              << "  --dt=<seconds>       integration time step\n"
+              << "  --threads=<n>        force-loop threads (default: hardware concurrency)\n"
+              << "  --steps-per-second=<n> physics rate of the simulation thread (0 = unlimited, default 60)\n"
+              << "  --asteroids=<n>      massless test particles in the main belt\n"
+              << "  --kuiper=<n>         massless test particles in the Kuiper belt\n"
+              << "  --scale=real|cbrt    drawn body radii: real or cube-root (default real)\n"
+              << "  --trail-length=<n>   orbit trail points per body (0 = off, default 256)\n"
+              << "  --trail-particles=<n> test particles that also leave a trail (default 0)\n"
+              << "  --width=<px>         window or offscreen frame width (default 1280)\n"
+              << "  --height=<px>        window or offscreen frame height (default 720)\n"
+              << "  --profile            per-pass CPU/GPU timings and frame-time percentiles\n"
+              << "  --trace=<file>       record CPU zones and GPU passes to a Chrome trace (T writes it now)\n"
+              << "  --record=<file>      record keys, camera and physics step of every frame\n"
+              << "  --replay=<file>      replay a recording at uncapped frame rate and report frame times\n"
+              << "  --monitor=<steps>    log energy/angular-momentum drift every n steps (0 = off)\n"
+              << "  --offscreen          render without a window (EGL) and save frames as PPM\n"
+              << "  --frames=<n>         offscreen: frames to render (default 300)\n"
+              << "  --frame-dir=<dir>    offscreen: output directory (default frames)\n"
+              << "  --steps=<n>          headless: number of steps to integrate\n"
+              << "  --years=<value>      headless: simulated time span in years (alternative to --steps)\n"
+              << "  --output=<file>      headless: CSV file for the final state (default stdout)\n"
+              << "  --max-drift=<value>  headless: abort when the relative drift exceeds this (needs --monitor)\n";
+}
+
+// Retorna o valor de "--nome=valor" se arg começar com o prefixo, senão nullptr
+inline const char* optionValue(const char* arg, const char* name) {
+    size_t len = std::strlen(name);
+    if (std::strncmp(arg, name, len) == 0 && arg[len] == '=') return arg + len + 1;
+    return nullptr;
+}
+
+inline SimOptions parseOptions(int argc, char** argv) {
+    SimOptions opts;
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const char* value;
+        if (std::strcmp(arg, "--help") == 0 || std::strcmp(arg, "-h") == 0) {
+            printUsage(argv[0]);
+            std::exit(0);
+        } else if ((value = optionValue(arg, "--solver"))) {
+            if (!parseForceBackend(value, opts.backend)) {
+                std::cerr << "Unknown solver: " << value << std::endl;
+            }
+        } else if ((value = optionValue(arg, "--theta"))) {
+            opts.theta = std::atof(value);
+        } else if ((value = optionValue(arg, "--integrator"))) {
+            if (!parseIntegrator(value, opts.integrator)) {
+                std::cerr << "Unknown integrator: " << value << std::endl;
+            }
+        } else if ((value = optionValue(arg, "--block-levels"))) {
+            opts.blockLevels = std::max(0, std::min(30, std::atoi(value)));
+        } else if ((value = optionValue(arg, "--block-eta"))) {
+            opts.blockEta = std::atof(value);
+        } else if ((value = optionValue(arg, "--dt"))) {
+            opts.dt = std::atof(value);
+        } else if ((value = optionValue(arg, "--threads"))) {
+            opts.threads = static_cast<unsigned>(std::max(1, std::atoi(value)));
+        } else if ((value = optionValue(arg, "--steps-per-second"))) {
+            opts.stepsPerSecond = std::max(0.0, std::atof(value));
+        } else if ((value = optionValue(arg, "--asteroids"))) {
+            opts.asteroids = std::strtoull(value, nullptr, 10);
+        } else if ((value = optionValue(arg, "--kuiper"))) {
+            opts.kuiper = std::strtoull(value, nullptr, 10);
+        } else if ((value = optionValue(arg, "--scale"))) {
+            if (!parseRadiusScale(value, opts.radiusScale)) {
+                std::cerr << "Unknown scale: " << value << std::endl;
+            }
+        } else if ((value = optionValue(arg, "--trail-length"))) {
+            opts.trailLength = std::max(0, std::atoi(value));
+        } else if ((value = optionValue(arg, "--trail-particles"))) {
+            opts.trailParticles = std::strtoull(value, nullptr, 10);
+        } else if ((value = optionValue(arg, "--width"))) {
+            opts.width = std::max(1, std::atoi(value));
+        } else if ((value = optionValue(arg, "--height"))) {
+            opts.height = std::max(1, std::atoi(value));
+        } else if (std::strcmp(arg, "--profile") == 0) {
+            opts.profile = true;
+        } else if ((value = optionValue(arg, "--trace"))) {
+            opts.trace = value;
+        } else if ((value = optionValue(arg, "--record"))) {
+            opts.record = value;
+        } else if ((value = optionValue(arg, "--replay"))) {
+            opts.replay = value;
+        } else if ((value = optionValue(arg, "--monitor"))) {
+            opts.monitorEvery = std::strtoull(value, nullptr, 10);
+        } else if (std::strcmp(arg, "--offscreen") == 0) {
+            opts.offscreen = true;
+        } else if ((value = optionValue(arg, "--frames"))) {
+            opts.frames = std::strtoull(value, nullptr, 10);
+        } else if ((value = optionValue(arg, "--frame-dir"))) {
+            opts.frameDir = value;
+        } else if ((value = optionValue(arg, "--steps"))) {
+            opts.steps = std::strtoull(value, nullptr, 10);
+        } else if ((value = optionValue(arg, "--years"))) {
+            opts.duration = std::atof(value) * 365.25 * 86400.0;
+        } else if ((value = optionValue(arg, "--output"))) {
+            opts.output = value;
+        } else if ((value = optionValue(arg, "--max-drift"))) {
+            opts.maxDrift = std::max(0.0, std::atof(value));
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+        }
+    }
+    return opts;
+}
+
+inline void configureSimulation(Simulation& sim, const SimOptions& opts) {
+    sim.solver.backend = opts.backend;
+    sim.solver.tree.theta = opts.theta;
+    sim.integrator.type = opts.integrator;
+    sim.integrator.block.maxLevel = opts.blockLevels;
+    sim.integrator.block.eta = opts.blockEta;
+    if (opts.dt > 0.0) sim.dt = opts.dt;
+    sim.monitor.cadence = opts.monitorEvery;
+    sim.monitor.maxDrift = opts.maxDrift;
+    sim.setThreads(opts.threads);
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "libs.h"
+#include "sim_thread.h"
+#include "frame_uniforms.h"
+
+
+// Desenho das partículas de teste como pontos. Usa linkProgram() do shader.h
+// incluído antes; câmera vem do uniform block Frame.
+const char* particleVertexShaderSource = "#version 330 core\n" FRAME_UNIFORM_BLOCK R"glsl(
+layout(location=0) in vec3 aPos;
+uniform float invPositionScale;
+void main() {
+    gl_Position = projection * view * vec4(aPos * invPositionScale, 1.0);
+    gl_PointSize = 1.5;
+}
+)glsl";
+
+const char* particleFragmentShaderSource = R"glsl(
+#version 330 core
+out vec4 FragColor;
+uniform vec4 color;
+void main() {
+    FragColor = color;
+}
+)glsl";
+
+struct ParticleRenderer {
+    GLuint program = 0, VAO = 0, VBO = 0;
+    GLint scaleLoc = -1;
+    size_t capacity = 0;    // Floats alocados no VBO
+    size_t pointCount = 0;
+    uint64_t uploadedStep = ~0ull;
+
+    void init() {
+        program = linkProgram(particleVertexShaderSource, particleFragmentShaderSource);
+
+        scaleLoc = glGetUniformLocation(program, "invPositionScale");
+        glUseProgram(program);
+        glUniform4f(glGetUniformLocation(program, "color"), 0.75f, 0.7f, 0.6f, 0.8f);
+
+        glGenVertexArrays(1, &VAO);
+        VBO = genTrackedBuffer(MemoryCategory::Dynamic, "particles");
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glBindVertexArray(0);
+    }
+
+    // Envia as posições só quando a física publicou um passo novo
+    void upload(const PhysicsSnapshot& snapshot) {
+        if (snapshot.steps == uploadedStep) return;
+        uploadedStep = snapshot.steps;
+        pointCount = snapshot.particles.size() / 3;
+        if (pointCount == 0) return;
+
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        size_t bytes = snapshot.particles.size() * sizeof(float);
+        if (snapshot.particles.size() > capacity) {
+            capacity = snapshot.particles.size();
+            trackedBufferData(GL_ARRAY_BUFFER, VBO, bytes, snapshot.particles.data(), GL_STREAM_DRAW);
+        } else {
+            trackedBufferData(GL_ARRAY_BUFFER, VBO, capacity * sizeof(float), nullptr, GL_STREAM_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, snapshot.particles.data());
+        }
+    }
+
+    void draw(double positionScale) {
+        if (pointCount == 0) return;
+        glUseProgram(program);
+        glUniform1f(scaleLoc, static_cast<float>(1.0 / positionScale));
+        glEnable(GL_PROGRAM_POINT_SIZE);
+        glBindVertexArray(VAO);
+        glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(pointCount));
+        glBindVertexArray(0);
+    }
+
+    void destroy() {
+        glDeleteVertexArrays(1, &VAO);
+        deleteTrackedBuffer(VBO);
+        glDeleteProgram(program);
+    }
+};
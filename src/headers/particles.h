@@ -0,0 +1,219 @@
+#pragma once
+
+#include "nbody.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+// Partículas de teste sem massa (asteroides, anéis, cinturão de Kuiper):
+// são aceleradas pelos corpos massivos do BodyStore mas não exercem força,
+// então o custo é O(N_massivos × N_partículas). Mesmo layout SoA alinhado
+// e com padding do BodyStore; aqui o SIMD vetoriza sobre as partículas.
+struct ParticleStore {
+    size_t count = 0;
+    size_t padded = 0;
+
+    DoubleArray x, y, z;
+    DoubleArray vx, vy, vz;
+    DoubleArray ax, ay, az;
+
+    // Aumenta o store para n partículas, preservando as existentes
+    void grow(size_t n) {
+        count = n;
+        padded = (n + NBODY_PAD - 1) / NBODY_PAD * NBODY_PAD;
+        for (DoubleArray* a : { &x, &y, &z, &vx, &vy, &vz, &ax, &ay, &az }) {
+            a->resize(padded, 0.0);
+        }
+    }
+};
+
+// Posições dos corpos massivos em cada estágio (kick) de um passo do integrador.
+// Só entram corpos com GM > 0; stage k ocupa [k·n, (k+1)·n) em x/y/z.
+// exclude deixa um corpo de fora (o central, no Wisdom–Holman).
+struct MassiveStages {
+    size_t n = 0;
+    int stages = 0;
+    int excluded = -1;
+    std::vector<double> x, y, z, gm;
+
+    void begin(const BodyStore& s, int stageCount, int exclude = -1) {
+        excluded = exclude;
+        gm.clear();
+        for (size_t j = 0; j < s.count; ++j) {
+            if (s.gm[j] > 0.0 && static_cast<int>(j) != excluded) gm.push_back(s.gm[j]);
+        }
+        n = gm.size();
+        stages = stageCount;
+        x.resize(n * stageCount);
+        y.resize(n * stageCount);
+        z.resize(n * stageCount);
+    }
+
+    void record(const BodyStore& s, int stage) {
+        size_t k = stage * n;
+        for (size_t j = 0; j < s.count; ++j) {
+            if (s.gm[j] <= 0.0 || static_cast<int>(j) == excluded) continue;
+            x[k] = s.x[j];
+            y[k] = s.y[j];
+            z[k] = s.z[j];
+            ++k;
+        }
+    }
+};
+
+// Aceleração das partículas [begin, end) devido às n fontes massivas dadas.
+// begin é múltiplo de NBODY_PAD e os kernels SIMD processam até o padding.
+typedef void (*ParticleKernel)(ParticleStore& p, size_t begin, size_t end,
+                               const double* mx, const double* my, const double* mz,
+                               const double* mgm, size_t n);
+
+inline void particleKernelScalar(ParticleStore& p, size_t begin, size_t end,
+                                 const double* mx, const double* my, const double* mz,
+                                 const double* mgm, size_t n) {
+    for (size_t i = begin; i < end; ++i) {
+        double axi = 0.0, ayi = 0.0, azi = 0.0;
+        for (size_t j = 0; j < n; ++j) {
+            double dx = mx[j] - p.x[i];
+            double dy = my[j] - p.y[i];
+            double dz = mz[j] - p.z[i];
+            double r2 = dx * dx + dy * dy + dz * dz;
+            if (r2 == 0.0) continue;
+            double f = mgm[j] / (r2 * std::sqrt(r2));
+            axi += dx * f;
+            ayi += dy * f;
+            azi += dz * f;
+        }
+        p.ax[i] = axi;
+        p.ay[i] = ayi;
+        p.az[i] = azi;
+    }
+}
+
+#ifdef NBODY_X86
+
+// 4 partículas por instrução
+__attribute__((target("avx2,fma")))
+inline void particleKernelAVX2(ParticleStore& p, size_t begin, size_t end,
+                               const double* mx, const double* my, const double* mz,
+                               const double* mgm, size_t n) {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d halfv = _mm256_set1_pd(0.5);
+    const __m256d threeHalves = _mm256_set1_pd(1.5);
+    size_t stop = std::min(p.padded, (end + 3) / 4 * 4);
+
+    for (size_t i = begin; i < stop; i += 4) {
+        const __m256d xi = _mm256_load_pd(&p.x[i]);
+        const __m256d yi = _mm256_load_pd(&p.y[i]);
+        const __m256d zi = _mm256_load_pd(&p.z[i]);
+        __m256d axv = zero, ayv = zero, azv = zero;
+        for (size_t j = 0; j < n; ++j) {
+            __m256d dx = _mm256_sub_pd(_mm256_set1_pd(mx[j]), xi);
+            __m256d dy = _mm256_sub_pd(_mm256_set1_pd(my[j]), yi);
+            __m256d dz = _mm256_sub_pd(_mm256_set1_pd(mz[j]), zi);
+            __m256d r2 = _mm256_fmadd_pd(dx, dx, _mm256_fmadd_pd(dy, dy, _mm256_mul_pd(dz, dz)));
+            __m256d mask = _mm256_cmp_pd(r2, zero, _CMP_GT_OQ);
+            __m256d inv = _mm256_cvtps_pd(_mm_rsqrt_ps(_mm256_cvtpd_ps(r2)));
+            __m256d hr2 = _mm256_mul_pd(halfv, r2);
+            inv = _mm256_mul_pd(inv, _mm256_fnmadd_pd(hr2, _mm256_mul_pd(inv, inv), threeHalves));
+            inv = _mm256_mul_pd(inv, _mm256_fnmadd_pd(hr2, _mm256_mul_pd(inv, inv), threeHalves));
+            __m256d f = _mm256_and_pd(mask, _mm256_mul_pd(_mm256_set1_pd(mgm[j]),
+                                                          _mm256_mul_pd(inv, _mm256_mul_pd(inv, inv))));
+            axv = _mm256_fmadd_pd(dx, f, axv);
+            ayv = _mm256_fmadd_pd(dy, f, ayv);
+            azv = _mm256_fmadd_pd(dz, f, azv);
+        }
+        _mm256_store_pd(&p.ax[i], axv);
+        _mm256_store_pd(&p.ay[i], ayv);
+        _mm256_store_pd(&p.az[i], azv);
+    }
+}
+
+// 8 partículas por instrução
+__attribute__((target("avx512f")))
+inline void particleKernelAVX512(ParticleStore& p, size_t begin, size_t end,
+                                 const double* mx, const double* my, const double* mz,
+                                 const double* mgm, size_t n) {
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d halfv = _mm512_set1_pd(0.5);
+    const __m512d threeHalves = _mm512_set1_pd(1.5);
+    size_t stop = std::min(p.padded, (end + 7) / 8 * 8);
+
+    for (size_t i = begin; i < stop; i += 8) {
+        const __m512d xi = _mm512_load_pd(&p.x[i]);
+        const __m512d yi = _mm512_load_pd(&p.y[i]);
+        const __m512d zi = _mm512_load_pd(&p.z[i]);
+        __m512d axv = zero, ayv = zero, azv = zero;
+        for (size_t j = 0; j < n; ++j) {
+            __m512d dx = _mm512_sub_pd(_mm512_set1_pd(mx[j]), xi);
+            __m512d dy = _mm512_sub_pd(_mm512_set1_pd(my[j]), yi);
+            __m512d dz = _mm512_sub_pd(_mm512_set1_pd(mz[j]), zi);
+            __m512d r2 = _mm512_fmadd_pd(dx, dx, _mm512_fmadd_pd(dy, dy, _mm512_mul_pd(dz, dz)));
+            __mmask8 mask = _mm512_cmp_pd_mask(r2, zero, _CMP_GT_OQ);
+            __m512d inv = _mm512_rsqrt14_pd(r2);
+            __m512d hr2 = _mm512_mul_pd(halfv, r2);
+            inv = _mm512_mul_pd(inv, _mm512_fnmadd_pd(hr2, _mm512_mul_pd(inv, inv), threeHalves));
+            inv = _mm512_mul_pd(inv, _mm512_fnmadd_pd(hr2, _mm512_mul_pd(inv, inv), threeHalves));
+            __m512d f = _mm512_maskz_mul_pd(mask, _mm512_set1_pd(mgm[j]),
+                                            _mm512_mul_pd(inv, _mm512_mul_pd(inv, inv)));
+            axv = _mm512_fmadd_pd(dx, f, axv);
+            ayv = _mm512_fmadd_pd(dy, f, ayv);
+            azv = _mm512_fmadd_pd(dz, f, azv);
+        }
+        _mm512_store_pd(&p.ax[i], axv);
+        _mm512_store_pd(&p.ay[i], ayv);
+        _mm512_store_pd(&p.az[i], azv);
+    }
+}
+
+#endif
+
+inline ParticleKernel particleKernelFor(SimdLevel level) {
+#ifdef NBODY_X86
+    if (level == SimdLevel::AVX512) return particleKernelAVX512;
+    if (level == SimdLevel::AVX2) return particleKernelAVX2;
+#endif
+    return particleKernelScalar;
+}
+
+inline ParticleKernel activeParticleKernel() {
+    static const ParticleKernel kernel = particleKernelFor(detectSimdLevel());
+    return kernel;
+}
+
+// Cinturão de partículas em órbitas circulares ao redor de centralGM, com raio
+// uniforme em [rMin, rMax], inclinação até ±maxInclination (graus) em relação
+// ao plano XZ dos planetas e nó ascendente aleatório.
+inline void addBeltParticles(ParticleStore& p, size_t count, double rMin, double rMax,
+                             double maxInclination, double centralGM, uint32_t seed) {
+    const double PI = 3.14159265358979323846;
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    size_t first = p.count;
+    p.grow(first + count);
+    for (size_t i = first; i < p.count; ++i) {
+        double r = rMin + (rMax - rMin) * unit(rng);
+        double phase = 2.0 * PI * unit(rng);
+        double node = 2.0 * PI * unit(rng);
+        double inc = (2.0 * unit(rng) - 1.0) * maxInclination * PI / 180.0;
+        double v = std::sqrt(centralGM / r);
+
+        // Órbita no plano XZ, inclinada em torno de X e girada pelo nó ascendente em Y
+        double px = r * std::cos(phase), pz = r * std::sin(phase);
+        double qx = -v * std::sin(phase), qz = v * std::cos(phase);
+        double py = pz * std::sin(inc), qy = qz * std::sin(inc);
+        pz *= std::cos(inc);
+        qz *= std::cos(inc);
+
+        double cn = std::cos(node), sn = std::sin(node);
+        p.x[i] = px * cn + pz * sn;
+        p.z[i] = -px * sn + pz * cn;
+        p.y[i] = py;
+        p.vx[i] = qx * cn + qz * sn;
+        p.vz[i] = -qx * sn + qz * cn;
+        p.vy[i] = qy;
+    }
+}
@@ -0,0 +1,264 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+// Instrumentação leve, sem dependência de OpenGL: zonas de CPU com escopo
+// (PROFILE_ZONE) medem com o relógio monotônico e gravam um ProfileEvent no
+// anel da própria thread. Cada anel tem um só produtor (a thread dona) e um
+// só consumidor (quem chama Profiler::drain, uma vez por quadro), então a
+// gravação não usa trava; se o consumidor atrasar, os eventos novos são
+// descartados e contados. Desligado (padrão), uma zona custa uma leitura
+// atômica. Os tempos das passadas da GPU vêm do gpu_timer.h.
+typedef std::chrono::steady_clock ProfileClock;
+
+const size_t PROFILE_RING_EVENTS = 1 << 14;    // Por thread; potência de 2
+
+// Nanossegundos desde a primeira chamada
+inline uint64_t profileNow() {
+    static const ProfileClock::time_point origin = ProfileClock::now();
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(ProfileClock::now() - origin).count());
+}
+
+struct ProfileEvent {
+    const char* name;       // Literal: só o ponteiro é guardado
+    uint64_t start, end;    // ns (profileNow)
+    uint32_t thread;        // Ordem de registro da thread
+};
+
+class ProfileEventRing {
+public:
+    ProfileEventRing(uint32_t threadIndex, size_t capacity) : thread(threadIndex), events(capacity), mask(capacity - 1) {}
+
+    // Só a thread dona
+    void push(const char* name, uint64_t start, uint64_t end) {
+        uint64_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= events.size()) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        events[h & mask] = { name, start, end, thread };
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    // Só o consumidor
+    template <typename Visitor>
+    void drain(Visitor&& visit) {
+        uint64_t t = tail.load(std::memory_order_relaxed);
+        uint64_t h = head.load(std::memory_order_acquire);
+        for (; t < h; ++t) visit(events[t & mask]);
+        tail.store(h, std::memory_order_release);
+    }
+
+    const uint32_t thread;
+    std::string name;       // Nome da trilha no trace (Profiler::setThreadName)
+    std::atomic<uint64_t> dropped{ 0 };
+
+private:
+    std::vector<ProfileEvent> events;
+    const size_t mask;
+    std::atomic<uint64_t> head{ 0 }, tail{ 0 };
+};
+
+class Profiler {
+public:
+    static Profiler& instance() {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    bool enabled() const { return on.load(std::memory_order_relaxed); }
+    void setEnabled(bool value) { on.store(value, std::memory_order_relaxed); }
+
+    // Anel da thread atual, criado (sob trava) no primeiro uso
+    ProfileEventRing& threadRing() {
+        thread_local ProfileEventRing* ring = nullptr;
+        if (!ring) {
+            std::lock_guard<std::mutex> lock(mutex);
+            rings.push_back(std::unique_ptr<ProfileEventRing>(
+                new ProfileEventRing(static_cast<uint32_t>(rings.size()), PROFILE_RING_EVENTS)));
+            ring = rings.back().get();
+        }
+        return *ring;
+    }
+
+    void record(const char* name, uint64_t start, uint64_t end) {
+        threadRing().push(name, start, end);
+    }
+
+    // Nome da thread atual nos traces exportados
+    void setThreadName(const char* name) {
+        ProfileEventRing& ring = threadRing();
+        std::lock_guard<std::mutex> lock(mutex);
+        ring.name = name;
+    }
+
+    // Nomes por índice de thread (sem nome: "thread N")
+    std::vector<std::string> threadNames() {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<std::string> names;
+        for (auto& ring : rings) {
+            names.push_back(ring->name.empty() ? "thread " + std::to_string(ring->thread) : ring->name);
+        }
+        return names;
+    }
+
+    // Entrega os eventos de todas as threads (em ordem dentro de cada thread)
+    template <typename Visitor>
+    void drain(Visitor&& visit) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto& ring : rings) ring->drain(visit);
+    }
+
+    uint64_t dropped() {
+        std::lock_guard<std::mutex> lock(mutex);
+        uint64_t total = 0;
+        for (auto& ring : rings) total += ring->dropped.load(std::memory_order_relaxed);
+        return total;
+    }
+
+private:
+    std::atomic<bool> on{ false };
+    std::mutex mutex;       // Só o registro de threads e o drain
+    std::vector<std::unique_ptr<ProfileEventRing>> rings;
+};
+
+class ProfileZone {
+public:
+    explicit ProfileZone(const char* zoneName)
+        : name(zoneName), active(Profiler::instance().enabled()), start(active ? profileNow() : 0) {}
+    ~ProfileZone() {
+        if (active) Profiler::instance().record(name, start, profileNow());
+    }
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* name;
+    bool active;
+    uint64_t start;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name) ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+
+// Janela deslizante das últimas `window` amostras, com percentis
+class RollingPercentiles {
+public:
+    explicit RollingPercentiles(size_t windowSize = 240) : window(windowSize) { samples.reserve(window); }
+
+    void add(double value) {
+        if (samples.size() < window) samples.push_back(value);
+        else samples[next] = value;
+        next = (next + 1) % window;
+    }
+
+    // Percentil p (0–100) pelo posto mais próximo
+    double percentile(double p) {
+        if (samples.empty()) return 0.0;
+        sorted.assign(samples.begin(), samples.end());
+        size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+        rank = std::min(sorted.size() - 1, rank > 0 ? rank - 1 : 0);
+        std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+        return sorted[rank];
+    }
+
+    size_t size() const { return samples.size(); }
+
+private:
+    size_t window;
+    size_t next = 0;
+    std::vector<double> samples;
+    std::vector<double> sorted;
+};
+
+// Totais de CPU e GPU por zona num intervalo de relatório, em ms por quadro
+struct ProfileSummary {
+    struct Entry {
+        const char* name;
+        double cpuMs = 0.0, gpuMs = 0.0;
+        bool hasGpu = false;
+    };
+    std::vector<Entry> entries;     // Na ordem em que apareceram
+    uint64_t frames = 0;
+
+    Entry& entry(const char* name) {
+        for (Entry& e : entries) {
+            if (e.name == name || std::strcmp(e.name, name) == 0) return e;
+        }
+        entries.push_back({ name });
+        return entries.back();
+    }
+
+    void addCpu(const ProfileEvent& event) {
+        entry(event.name).cpuMs += (event.end - event.start) * 1e-6;
+    }
+
+    void addGpu(const char* name, double ms) {
+        Entry& e = entry(name);
+        e.gpuMs += ms;
+        e.hasGpu = true;
+    }
+
+    // Tabela com média por quadro de cada zona e percentis do tempo de quadro
+    std::string report(RollingPercentiles& frameTimes, uint64_t dropped) const {
+        std::string text;
+        char line[128];
+        std::snprintf(line, sizeof(line), "frame ms  p50 %.2f  p95 %.2f  p99 %.2f  (%zu frames)\n",
+                      frameTimes.percentile(50), frameTimes.percentile(95), frameTimes.percentile(99),
+                      frameTimes.size());
+        text += line;
+        double perFrame = frames ? 1.0 / frames : 0.0;
+        for (const Entry& e : entries) {
+            if (e.hasGpu) {
+                std::snprintf(line, sizeof(line), "  %-16s cpu %7.3f ms  gpu %7.3f ms\n",
+                              e.name, e.cpuMs * perFrame, e.gpuMs * perFrame);
+            } else {
+                std::snprintf(line, sizeof(line), "  %-16s cpu %7.3f ms\n", e.name, e.cpuMs * perFrame);
+            }
+            text += line;
+        }
+        if (dropped) {
+            std::snprintf(line, sizeof(line), "  (%llu events dropped)\n", static_cast<unsigned long long>(dropped));
+            text += line;
+        }
+        return text;
+    }
+
+    // Resumo de uma linha (título da janela)
+    std::string title(const char* prefix, RollingPercentiles& frameTimes) const {
+        char line[160];
+        std::snprintf(line, sizeof(line), "%s | frame p50 %.2f  p95 %.2f  p99 %.2f ms",
+                      prefix, frameTimes.percentile(50), frameTimes.percentile(95), frameTimes.percentile(99));
+        std::string text = line;
+        // As duas passadas mais caras na GPU
+        std::vector<const Entry*> gpu;
+        for (const Entry& e : entries) {
+            if (e.hasGpu) gpu.push_back(&e);
+        }
+        std::sort(gpu.begin(), gpu.end(), [](const Entry* a, const Entry* b) { return a->gpuMs > b->gpuMs; });
+        double perFrame = frames ? 1.0 / frames : 0.0;
+        for (size_t k = 0; k < gpu.size() && k < 2; ++k) {
+            std::snprintf(line, sizeof(line), " | %s %.2f ms", gpu[k]->name, gpu[k]->gpuMs * perFrame);
+            text += line;
+        }
+        return text;
+    }
+
+    void reset() {
+        entries.clear();
+        frames = 0;
+    }
+};
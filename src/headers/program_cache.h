@@ -0,0 +1,100 @@
+#pragma once
+
+#include "libs.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+
+// Cache em disco dos programas linkados (glGetProgramBinary / glProgramBinary).
+// Cada arquivo é identificado pelo hash das fontes do vertex e do fragment
+// shader e das strings de vendor, renderer e versão do driver, então trocar
+// de shader ou de driver gera outra chave. Um binário que o driver recusa
+// (GL_LINK_STATUS falso) é tratado como cache velho: quem chama compila de
+// novo e regrava. Sem ARB_get_program_binary o cache fica desligado.
+const char* const PROGRAM_CACHE_DIR = "shader_cache";
+
+// FNV-1a de 64 bits, acumulável
+const uint64_t FNV_OFFSET_BASIS = 1469598103934665603ull;
+
+inline uint64_t fnv1a(const char* data, size_t size, uint64_t hash) {
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+inline uint64_t hashString(const char* text, uint64_t hash) {
+    return fnv1a(text, text ? std::strlen(text) + 1 : 0, hash);   // Inclui o '\0' como separador
+}
+
+inline bool programCacheSupported() {
+    return GLEW_ARB_get_program_binary || GLEW_VERSION_4_1;
+}
+
+inline std::string programCachePath(const char* vertexSource, const char* fragmentSource) {
+    uint64_t hash = hashString(vertexSource, FNV_OFFSET_BASIS);
+    hash = hashString(fragmentSource, hash);
+    hash = hashString(reinterpret_cast<const char*>(glGetString(GL_VENDOR)), hash);
+    hash = hashString(reinterpret_cast<const char*>(glGetString(GL_RENDERER)), hash);
+    hash = hashString(reinterpret_cast<const char*>(glGetString(GL_VERSION)), hash);
+
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(hash));
+    return std::string(PROGRAM_CACHE_DIR) + "/" + name;
+}
+
+// Formato do arquivo: GLenum do formato binário seguido do binário
+inline GLuint loadCachedProgram(const std::string& path) {
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) return 0;
+
+    GLenum format = 0;
+    std::vector<char> binary;
+    bool ok = std::fread(&format, sizeof(format), 1, file) == 1;
+    if (ok) {
+        std::fseek(file, 0, SEEK_END);
+        long end = std::ftell(file);
+        ok = end > static_cast<long>(sizeof(format));
+        if (ok) {
+            binary.resize(static_cast<size_t>(end) - sizeof(format));
+            std::fseek(file, sizeof(format), SEEK_SET);
+            ok = std::fread(binary.data(), 1, binary.size(), file) == binary.size();
+        }
+    }
+    std::fclose(file);
+    if (!ok) return 0;
+
+    GLuint program = glCreateProgram();
+    glProgramBinary(program, format, binary.data(), static_cast<GLsizei>(binary.size()));
+    GLint success = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success) {
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+// O programa deve ter sido linkado com GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+inline void storeCachedProgram(const std::string& path, GLuint program) {
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    std::vector<char> binary(static_cast<size_t>(length));
+    GLenum format = 0;
+    glGetProgramBinary(program, length, nullptr, &format, binary.data());
+
+    std::error_code error;
+    std::filesystem::create_directories(PROGRAM_CACHE_DIR, error);
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) return;
+    std::fwrite(&format, sizeof(format), 1, file);
+    std::fwrite(binary.data(), 1, binary.size(), file);
+    std::fclose(file);
+}
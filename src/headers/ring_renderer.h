@@ -0,0 +1,108 @@
+#pragma once
+
+#include "libs.h"
+#include "mesh.h"
+#include "solar_system.h"
+#include "texture_upload.h"
+#include <vector>
+
+
+// Anéis planetários (ringData de solar_system.h) com uma única coroa plana
+// indexada de poucas centenas de vértices. Os raios vão por uniform e a
+// textura (uma faixa radial, como 2k_saturn_ring_alpha.png) é lida no
+// fragment shader pela distância ao centro (decodificada em texture_loader.h).
+// Usa o programa de createRingProgram() (shader.h); câmera vem do uniform
+// block Frame (frame_uniforms.h).
+const int RING_SEGMENTS = 128;
+
+struct RingRenderer {
+    GLuint program = 0, VAO = 0, VBO = 0, EBO = 0;
+    GLint modelLoc = -1, innerLoc = -1, outerLoc = -1;
+    GLsizei indexCount = 0;
+    RadiusScale scale = RadiusScale::Real;  // Mesma escala dos astros
+    std::vector<GLuint> textures;   // Uma por entrada de ringData
+
+    void init(GLuint ringProgram, RadiusScale radiusScale) {
+        program = ringProgram;
+        scale = radiusScale;
+        modelLoc = glGetUniformLocation(program, "model");
+        innerLoc = glGetUniformLocation(program, "innerRadius");
+        outerLoc = glGetUniformLocation(program, "outerRadius");
+        glUseProgram(program);
+        glUniform1i(glGetUniformLocation(program, "texture1"), 0);  // Unidade de textura 0
+
+        std::vector<float> vertices;
+        std::vector<unsigned> indices;
+        createRingMesh(RING_SEGMENTS, vertices, indices);
+        indexCount = static_cast<GLsizei>(indices.size());
+
+        glGenVertexArrays(1, &VAO);
+        VBO = genTrackedBuffer(MemoryCategory::Mesh, "ring vertices");
+        EBO = genTrackedBuffer(MemoryCategory::Mesh, "ring indices");
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        trackedBufferData(GL_ARRAY_BUFFER, VBO, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        trackedBufferData(GL_ELEMENT_ARRAY_BUFFER, EBO, indices.size() * sizeof(unsigned), indices.data(), GL_STATIC_DRAW);
+
+        // Direção no plano e borda (interna/externa)
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 1, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)(2 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        glBindVertexArray(0);
+
+        // Uma textura por anel, preenchida por uploadTexture
+        textures.resize(ringData.size());
+        for (size_t k = 0; k < ringData.size(); ++k) {
+            GLuint texture = textures[k] = genTrackedTexture("ring texture");
+            if (ringData[k].body >= 0 && static_cast<size_t>(ringData[k].body) < solarSystemData.size()) {
+                MemoryRegistry::instance().setOwners(MemoryObject::Texture, texture,
+                    { memoryOwnerName(solarSystemData[ringData[k].body].textureFile) });
+            }
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        }
+    }
+
+    // Envia a textura do anel k já decodificada (AsyncImageDecoder)
+    void uploadTexture(size_t k, const DecodedImage& image) {
+        if (k >= textures.size() || !image.pixels) return;
+        uploadImage2D(textures[k], image);
+    }
+
+    // Deixa o programa dos anéis ativo
+    template <typename Body>
+    void draw(const std::vector<Body>& bodies, double positionScale) {
+        glUseProgram(program);
+        glActiveTexture(GL_TEXTURE0);
+        glBindVertexArray(VAO);
+
+        for (size_t k = 0; k < ringData.size(); ++k) {
+            const RingData& ring = ringData[k];
+            if (ring.body < 0 || static_cast<size_t>(ring.body) >= bodies.size()) continue;
+
+            glm::mat4 ringModel = glm::mat4(1.0f);
+            ringModel = glm::translate(ringModel, glm::vec3(bodies[ring.body].position / positionScale));
+            ringModel = glm::rotate(ringModel, glm::radians(-90.0f), glm::vec3(1.0f, 0.0f, 0.0f)); // Plano XZ da órbita
+            ringModel = glm::rotate(ringModel, glm::radians(static_cast<float>(-ring.tilt)), glm::vec3(0.0f, 0.0f, 1.0f)); // Inclinação axial
+            glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(ringModel));
+            glUniform1f(innerLoc, static_cast<float>(displayRadius(ring.innerRadius, scale)));
+            glUniform1f(outerLoc, static_cast<float>(displayRadius(ring.outerRadius, scale)));
+
+            glBindTexture(GL_TEXTURE_2D, textures[k]);
+            glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, (void*)0);
+        }
+        glBindVertexArray(0);
+    }
+
+    void destroy() {
+        glDeleteVertexArrays(1, &VAO);
+        deleteTrackedBuffer(VBO);
+        deleteTrackedBuffer(EBO);
+        for (GLuint& texture : textures) deleteTrackedTexture(texture);
+    }
+};
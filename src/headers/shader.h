@@ -0,0 +1,241 @@
+#pragma once
+
+#include "libs.h"
+#include "frame_uniforms.h"
+#include "program_cache.h"
+#include <string>
+#include <unordered_map>
+
+
+// Fonte única dos astros e do fundo. Cada combinação de flags vira um
+// programa (permutação), compilado na primeira vez que é pedido ao
+// ShaderCache e reaproveitado depois:
+//   SHADER_TEXTURED  cor da textura (camada por instância, ou a do céu)
+//   SHADER_LIT       iluminação Phong pela luz do uniform block Frame
+//   SHADER_EMISSIVE  brilho próprio (Sol), sem iluminação
+//   SHADER_SKY       quad de fundo já em coordenadas de clip, sem matrizes
+//   SHADER_POINT     astro de poucos pixels como ponto, na cor média da textura
+enum ShaderFeature : unsigned {
+    SHADER_TEXTURED = 1u << 0,
+    SHADER_LIT      = 1u << 1,
+    SHADER_EMISSIVE = 1u << 2,
+    SHADER_SKY      = 1u << 3,
+    SHADER_POINT    = 1u << 4,
+};
+
+// Programas usados pelo laço de renderização
+const unsigned SKY_PROGRAM = SHADER_SKY | SHADER_TEXTURED;
+const unsigned SUN_PROGRAM = SHADER_TEXTURED | SHADER_EMISSIVE;
+const unsigned PLANET_PROGRAM = SHADER_TEXTURED | SHADER_LIT;
+const unsigned POINT_PROGRAM = SHADER_TEXTURED | SHADER_POINT;
+
+const char* bodyVertexShaderSource = R"glsl(
+layout(location=0) in vec3 aPos;
+layout(location=1) in vec2 aTexCoord;
+#ifdef SKY
+out vec2 TexCoord;
+void main() {
+    gl_Position = vec4(aPos, 1.0);
+    TexCoord = aTexCoord;
+}
+#else
+// Esfera unitária + posição, escala e camada da textura por instância (SphereRenderer)
+layout(location=2) in vec3 aNormal;
+layout(location=3) in vec4 aOffsetScale;
+layout(location=4) in float aLayer;
+out vec3 TexCoord;
+out vec3 FragPos;
+out vec3 Normal;
+void main() {
+    // Só translação e escala uniforme: a normal não muda
+    FragPos = aPos * aOffsetScale.w + aOffsetScale.xyz;
+    Normal = aNormal;
+    gl_Position = projection * view * vec4(FragPos, 1.0);
+    TexCoord = vec3(aTexCoord, aLayer);
+#ifdef POINT
+    gl_PointSize = 4.0;
+#endif
+}
+#endif
+)glsl";
+
+const char* bodyFragmentShaderSource = R"glsl(
+out vec4 FragColor;
+#ifdef SKY
+in vec2 TexCoord;
+uniform sampler2D texture1;
+#else
+in vec3 TexCoord;
+in vec3 FragPos;
+in vec3 Normal;
+uniform sampler2DArray texture1;
+#endif
+
+void main() {
+#if defined(TEXTURED) && defined(POINT)
+    // Último nível de mipmap = cor média da camada
+    vec4 color = textureLod(texture1, TexCoord, 16.0);
+#elif defined(TEXTURED)
+    vec4 color = texture(texture1, TexCoord);
+#else
+    vec4 color = vec4(1.0);
+#endif
+
+#ifdef EMISSIVE
+    color *= vec4(2.0, 2.0, 1.5, 1.0);
+#endif
+
+#ifdef LIT
+    vec3 norm = normalize(Normal);
+    vec3 lightDir = normalize(lightPos.xyz - FragPos);
+    vec3 viewDir = normalize(viewPos.xyz - FragPos);
+    vec3 reflectDir = reflect(-lightDir, norm);
+
+    float ambientStrength = 0.1;
+    vec3 ambient = ambientStrength * lightColor.rgb;
+
+    float diff = max(dot(norm, lightDir), 0.0);
+    vec3 diffuse = diff * lightColor.rgb;
+
+    float specularStrength = 0.5;
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32);
+    vec3 specular = specularStrength * spec * lightColor.rgb;
+
+    color = vec4((ambient + diffuse + specular) * color.rgb, 1.0);
+#endif
+
+    FragColor = color;
+}
+)glsl";
+
+// Anéis: coroa plana com raios por uniform; a textura é lida pela distância
+// radial do fragmento, então a borda interna é um círculo exato. O perfil
+// radial de 2k_saturn_ring_alpha.png corre ao longo de V (linha 0 do PNG é a
+// borda externa); com a inversão vertical do stbi, v = 0 é a borda interna
+const char* ringVertexShaderSource = "#version 330 core\n" FRAME_UNIFORM_BLOCK R"glsl(
+layout(location=0) in vec2 aDirection;
+layout(location=1) in float aEdge;
+out vec2 LocalPos;
+uniform mat4 model;
+uniform float innerRadius;
+uniform float outerRadius;
+void main() {
+    LocalPos = aDirection * mix(innerRadius, outerRadius, aEdge);
+    gl_Position = projection * view * model * vec4(LocalPos, 0.0, 1.0);
+}
+)glsl";
+
+const char* ringFragmentShaderSource = R"glsl(
+#version 330 core
+out vec4 FragColor;
+in vec2 LocalPos;
+uniform sampler2D texture1;
+uniform float innerRadius;
+uniform float outerRadius;
+void main() {
+    float t = (length(LocalPos) - innerRadius) / (outerRadius - innerRadius);
+    if (t < 0.0 || t > 1.0) discard;
+    FragColor = texture(texture1, vec2(0.5, t));
+}
+)glsl";
+
+// Compilação de shaders com base no source apresentado
+GLuint compileShader(GLenum type, const char* source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+
+    GLint success;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (!success) {
+        char infoLog[512];
+        glGetShaderInfoLog(shader, 512, nullptr, infoLog);
+        std::cerr << "Shader compilation error:\n" << infoLog << std::endl;
+    }
+
+    return shader;
+}
+
+
+// Linkagem de shaders. Com suporte do driver, o programa vem do cache de
+// binários (program_cache.h) quando existe um válido para estas fontes, e é
+// gravado nele depois de compilado.
+GLuint linkProgram(const char* vertexSource, const char* fragmentSource) {
+    std::string cachePath;
+    if (programCacheSupported()) {
+        cachePath = programCachePath(vertexSource, fragmentSource);
+        GLuint cached = loadCachedProgram(cachePath);
+        if (cached) {
+            bindFrameUniforms(cached);
+            return cached;
+        }
+    }
+
+    GLuint vertexShader = compileShader(GL_VERTEX_SHADER, vertexSource);
+    GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, fragmentSource);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    if (!cachePath.empty()) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(program);
+    bindFrameUniforms(program);
+
+    GLint success;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success) {
+        char infoLog[512];
+        glGetProgramInfoLog(program, 512, nullptr, infoLog);
+        std::cerr << "Shader program linking error:\n" << infoLog << std::endl;
+    } else if (!cachePath.empty()) {
+        storeCachedProgram(cachePath, program);
+    }
+
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    return program;
+}
+
+// Cabeçalho de uma permutação: versão, um #define por flag e o uniform block
+inline std::string shaderPrelude(unsigned features) {
+    std::string prelude = "#version 330 core\n";
+    if (features & SHADER_TEXTURED) prelude += "#define TEXTURED\n";
+    if (features & SHADER_LIT) prelude += "#define LIT\n";
+    if (features & SHADER_EMISSIVE) prelude += "#define EMISSIVE\n";
+    if (features & SHADER_SKY) prelude += "#define SKY\n";
+    if (features & SHADER_POINT) prelude += "#define POINT\n";
+    prelude += FRAME_UNIFORM_BLOCK;
+    return prelude;
+}
+
+// Programas por combinação de flags, compilados sob demanda. A unidade de
+// textura do sampler é fixada no link, então trocar de permutação é só um
+// glUseProgram.
+struct ShaderCache {
+    std::unordered_map<unsigned, GLuint> programs;
+
+    GLuint get(unsigned features) {
+        auto it = programs.find(features);
+        if (it != programs.end()) return it->second;
+
+        std::string prelude = shaderPrelude(features);
+        std::string vertexSource = prelude + bodyVertexShaderSource;
+        std::string fragmentSource = prelude + bodyFragmentShaderSource;
+        GLuint program = linkProgram(vertexSource.c_str(), fragmentSource.c_str());
+        glUseProgram(program);
+        glUniform1i(glGetUniformLocation(program, "texture1"), 0);  // Unidade de textura 0
+        programs.emplace(features, program);
+        return program;
+    }
+
+    void destroy() {
+        for (auto& entry : programs) glDeleteProgram(entry.second);
+        programs.clear();
+    }
+};
+
+// Anéis
+GLuint createRingProgram() {
+    return linkProgram(ringVertexShaderSource, ringFragmentShaderSource);
+}
@@ -0,0 +1,192 @@
+#pragma once
+
+#include "simulation.h"
+#include "profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+// Buffer triplo sem trava: o escritor preenche o slot de trás e o troca com o
+// do meio; o leitor troca o da frente com o do meio quando há dado novo.
+// Nenhum dos dois espera pelo outro e o leitor sempre vê um estado completo.
+template <typename T>
+class TripleBuffer {
+public:
+    T& writeBuffer() { return slots[back]; }
+    const T& readBuffer() const { return slots[front]; }
+
+    // Escritor: publica o slot de trás
+    void publish() {
+        back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & INDEX;
+    }
+
+    // Leitor: pega o último estado publicado; retorna false se nada mudou
+    bool update() {
+        if (!(middle.load(std::memory_order_relaxed) & FRESH)) return false;
+        front = middle.exchange(front, std::memory_order_acq_rel) & INDEX;
+        return true;
+    }
+
+    // Inicializa os três slots com o mesmo valor (antes de iniciar as threads)
+    void fill(const T& value) {
+        for (T& slot : slots) slot = value;
+    }
+
+private:
+    static const unsigned INDEX = 3;
+    static const unsigned FRESH = 4;
+    T slots[3];
+    std::atomic<unsigned> middle{ 1 };
+    unsigned back = 0;
+    unsigned front = 2;
+};
+
+// Estado publicado para o renderizador. As partículas vão em float (x, y, z
+// intercalados), já no formato do VBO de pontos.
+struct PhysicsSnapshot {
+    std::vector<double> x, y, z;
+    std::vector<float> particles;
+    double simTime = 0.0;
+    uint64_t steps = 0;
+
+    void capture(const Simulation& sim, double time, uint64_t stepCount) {
+        const BodyStore& s = sim.store;
+        x.assign(s.x.begin(), s.x.begin() + s.count);
+        y.assign(s.y.begin(), s.y.begin() + s.count);
+        z.assign(s.z.begin(), s.z.begin() + s.count);
+
+        const ParticleStore& p = sim.particles;
+        particles.resize(3 * p.count);
+        for (size_t i = 0; i < p.count; ++i) {
+            particles[3 * i] = static_cast<float>(p.x[i]);
+            particles[3 * i + 1] = static_cast<float>(p.y[i]);
+            particles[3 * i + 2] = static_cast<float>(p.z[i]);
+        }
+        simTime = time;
+        steps = stepCount;
+    }
+};
+
+// Método para atualizar as posições dos astros com o último estado publicado pela thread da física
+template <typename Body>
+void updatePhysics(const PhysicsSnapshot& snapshot, std::vector<Body>& bodies) {
+    for (size_t i = 0; i < bodies.size() && i < snapshot.x.size(); ++i) {
+        bodies[i].position.x = snapshot.x[i];
+        bodies[i].position.y = snapshot.y[i];
+        bodies[i].position.z = snapshot.z[i];
+    }
+}
+
+// Roda a física numa thread própria com passo fixo dt. O tempo real decorrido
+// vezes stepsPerSecond alimenta um acumulador de passos pendentes, consumido
+// a cada volta do laço; stepsPerSecond = 0 roda o mais rápido possível.
+// Com lockstep (reprodução de entrada) o relógio é ignorado: a física só
+// avança até o passo pedido por waitFor.
+class SimulationThread {
+public:
+    explicit SimulationThread(Simulation& simulation) : sim(simulation) {}
+    ~SimulationThread() { stop(); }
+
+    double stepsPerSecond = 60.0;
+    int maxStepsPerTick = 64;   // Evita a "espiral da morte" quando a física atrasa
+    bool lockstep = false;      // Antes de start()
+
+    void start() {
+        PhysicsSnapshot initial;
+        initial.capture(sim, simTime, steps);
+        buffer.fill(initial);
+        running = true;
+        worker = std::thread([this] { run(); });
+    }
+
+    void stop() {
+        running = false;
+        if (worker.joinable()) worker.join();
+    }
+
+    // Chamado pela thread de renderização; nunca bloqueia
+    const PhysicsSnapshot& latest() {
+        buffer.update();
+        return buffer.readBuffer();
+    }
+
+    // Pedidos da thread de renderização, atendidos entre passos
+    void requestBackendToggle() { toggleRequested = true; }
+
+    // Lockstep: pede o passo `target` e espera o estado dele ser publicado.
+    // Um pedido de troca de backend feito antes é atendido antes desses passos.
+    const PhysicsSnapshot& waitFor(uint64_t target) {
+        targetSteps.store(target, std::memory_order_release);
+        for (;;) {
+            const PhysicsSnapshot& snapshot = latest();
+            if (snapshot.steps >= target) return snapshot;
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    void run() {
+        Profiler::instance().setThreadName("physics");
+        typedef std::chrono::steady_clock Clock;
+        Clock::time_point last = Clock::now();
+        double accumulator = 0.0;
+
+        while (running) {
+            // Lido antes do pedido de troca: um pedido feito antes do alvo nunca fica para depois
+            uint64_t target = targetSteps.load(std::memory_order_acquire);
+            if (toggleRequested.exchange(false)) {
+                sim.toggleBackend();
+                printForceAccuracy(sim.store, sim.solver);
+            }
+
+            int todo;
+            if (lockstep) {
+                todo = target > steps ? static_cast<int>(std::min<uint64_t>(target - steps, maxStepsPerTick)) : 0;
+            } else if (stepsPerSecond > 0.0) {
+                Clock::time_point now = Clock::now();
+                accumulator += std::chrono::duration<double>(now - last).count() * stepsPerSecond;
+                last = now;
+                todo = static_cast<int>(accumulator);
+                if (todo > maxStepsPerTick) {
+                    todo = maxStepsPerTick;
+                    accumulator = 0.0;
+                } else {
+                    accumulator -= todo;
+                }
+            } else {
+                todo = 1;
+            }
+
+            if (todo == 0) {
+                if (lockstep) std::this_thread::yield();
+                else std::this_thread::sleep_for(std::chrono::microseconds(500));
+                continue;
+            }
+
+            for (int k = 0; k < todo; ++k) {
+                PROFILE_ZONE("physics step");
+                sim.step();
+                simTime += sim.dt;
+                ++steps;
+            }
+            {
+                PROFILE_ZONE("publish snapshot");
+                buffer.writeBuffer().capture(sim, simTime, steps);
+                buffer.publish();
+            }
+        }
+    }
+
+    Simulation& sim;
+    TripleBuffer<PhysicsSnapshot> buffer;
+    std::thread worker;
+    std::atomic<bool> running{ false };
+    std::atomic<bool> toggleRequested{ false };
+    std::atomic<uint64_t> targetSteps{ 0 };
+    double simTime = 0.0;
+    uint64_t steps = 0;
+};
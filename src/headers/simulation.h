@@ -0,0 +1,57 @@
+#pragma once
+
+#include "nbody.h"
+#include "conservation.h"
+#include "gravity.h"
+#include "integrators.h"
+#include "particles.h"
+#include "thread_pool.h"
+
+
+// Estado completo da física: store SoA, partículas de teste, solver de
+// gravidade, integrador, pool de threads do laço de forças, passo de tempo
+// e monitor de conservação
+struct Simulation {
+    ThreadPool pool;
+    BodyStore store;
+    ParticleStore particles;
+    GravitySolver solver;
+    Integrator integrator;
+    ConservationMonitor monitor;
+    double dt = 43200.0;
+    uint64_t stepCount = 0;
+
+    void setThreads(unsigned threads) {
+        pool.start(threads);
+        solver.pool = &pool;
+    }
+
+    void step() {
+        // O potencial vem do laço de forças quando o integrador termina o
+        // passo avaliando a força; senão o monitor faz uma passada própria.
+        // A referência usa o mesmo caminho das amostras (mesmo backend).
+        bool fromForces = integrator.endsWithForces();
+        if (monitor.enabled() && !monitor.hasReference) {
+            if (fromForces) {
+                store.computePotential = true;
+                integrator.evaluateForces(store, solver);
+                store.computePotential = false;
+            }
+            monitor.sample(store, fromForces, &pool, stepCount, stepCount * dt);
+        }
+        bool sample = monitor.due(stepCount + 1);
+        store.computePotential = sample && fromForces;
+        integrator.step(store, solver, dt, &particles);
+        store.computePotential = false;
+        ++stepCount;
+        if (sample) {
+            monitor.sample(store, fromForces && integrator.forcesValid, &pool, stepCount, stepCount * dt);
+        }
+    }
+
+    void toggleBackend() {
+        solver.toggleBackend();
+        integrator.invalidate();
+        monitor.reset();
+    }
+};
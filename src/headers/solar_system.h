@@ -0,0 +1,125 @@
+#pragma once
+
+#include "nbody.h"
+#include "particles.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+
+// Dados do sistema solar e estado inicial, sem nenhuma dependência de OpenGL
+// (usados pelos executáveis com janela e pelo headless)
+const int NUM_BODIES = 9;
+
+const double G = 6.67430e-11;
+const double timeStep = 43200.0;     // 12 horas em segundos (0.5 dia terrestre)
+
+// Struct de definição para o vetor solarSystemData
+struct BodyData {
+    double mass;
+    double orbitRadius;
+    double radius;
+    glm::vec4 color;
+    double inclination;
+    const char* textureFile;
+};
+
+std::vector<BodyData> solarSystemData = {
+    //massa,   raio de órbita, raio do planeta,  vetor de cor,   inclinação e textura
+    {1.98847e30,    0.0,        7.9634e7, {1.0f, 0.8f, 0.0f, 1.0f}, 0.0, "assets/2k_sun.jpg"},
+    {3.3011e23,  5.4e11,    2.4397e5, {0.8f, 0.5f, 0.2f, 1.0f}, 7.0, "assets/2k_mercury.jpg"},
+    {4.8675e24, 7e11,    6.0518e5, {0.9f, 0.7f, 0.2f, 1.0f}, 3.4, "assets/2k_venus_surface.jpg"},
+    {5.9724e24, 11e11,    6.3710e5, {0.0f, 0.5f, 1.0f, 1.0f}, 0.0, "assets/2k_earth_daymap.jpg"},
+    {6.4171e23, 15e11,    3.3895e5, {1.0f, 0.2f, 0.1f, 1.0f}, 1.9, "assets/2k_mars.jpg"},
+    {1.8982e27, 23e11,   1e7, {0.9f, 0.6f, 0.3f, 1.0f}, 1.3, "assets/2k_jupiter.jpg"},
+    {5.6834e26, 28e11,   4.8232e6, {0.9f, 0.8f, 0.5f, 1.0f}, 2.5, "assets/2k_saturn.jpg"},
+    {8.6810e25, 37e11,   2.5362e6, {0.5f, 0.8f, 0.9f, 1.0f}, 0.8, "assets/2k_uranus.jpg"},
+    {1.02413e26, 4.503e12,  2.4622e6, {0.3f, 0.4f, 0.9f, 1.0f}, 1.8, "assets/2k_neptune.jpg"}
+};
+
+// Céu estrelado do plano de fundo
+const char* const skyTextureFile = "assets/2k_stars.jpg";
+
+// Anéis: astro, raios interno e externo (mesma unidade do raio em
+// solarSystemData), inclinação axial em graus e textura radial
+struct RingData {
+    int body;
+    double innerRadius;
+    double outerRadius;
+    double tilt;
+    const char* textureFile;
+};
+
+std::vector<RingData> ringData = {
+    {6, 7e6, 1.1e7, 26.73, "assets/2k_saturn_ring_alpha.png"}
+};
+
+// Escala do raio desenhado: "real" reduz todos os raios pelo mesmo fator;
+// "cbrt" usa a raiz cúbica do raio, que deixa os planetas visíveis ao lado do Sol
+enum class RadiusScale { Real, Cube };
+
+inline const char* radiusScaleName(RadiusScale scale) {
+    return scale == RadiusScale::Cube ? "cbrt" : "real";
+}
+
+inline bool parseRadiusScale(const char* name, RadiusScale& out) {
+    for (RadiusScale s : { RadiusScale::Real, RadiusScale::Cube }) {
+        if (std::strcmp(name, radiusScaleName(s)) == 0) { out = s; return true; }
+    }
+    return false;
+}
+
+// Raio em unidades de desenho (mesma unidade de posição / positionScale)
+inline double displayRadius(double realRadius, RadiusScale scale) {
+    if (scale == RadiusScale::Cube) return std::cbrt(realRadius) / 120.0;
+    return realRadius / 1e7;
+}
+
+// Posição e velocidade iniciais do astro i: o Sol parado na origem e os
+// planetas em órbita circular, inclinada em torno do eixo Z
+inline void initialState(int i, glm::dvec3& position, glm::dvec3& velocity) {
+    position = glm::dvec3(0.0);
+    velocity = glm::dvec3(0.0);
+    if (i == 0) return;
+
+    double inclination = glm::radians(solarSystemData[i].inclination);
+    double minDistance = (solarSystemData[0].radius + solarSystemData[i].radius) * 1.5;
+    double effectiveOrbitRadius = std::max(solarSystemData[i].orbitRadius, minDistance);
+
+    position = glm::dvec3(effectiveOrbitRadius, 0.0, 0.0);
+    double orbitalVelocity = std::sqrt(G * solarSystemData[0].mass / effectiveOrbitRadius);
+    velocity = glm::dvec3(0.0, 0.0, orbitalVelocity);
+
+    glm::dmat4 rotation = glm::rotate(glm::dmat4(1.0), inclination, glm::dvec3(0.0, 0.0, 1.0));
+    position = glm::dvec3(rotation * glm::dvec4(position, 1.0));
+    velocity = glm::dvec3(rotation * glm::dvec4(velocity, 0.0));
+}
+
+// Preenche o store direto com o estado inicial (sem criar os CelestialBody)
+inline void loadSolarSystem(BodyStore& s) {
+    s.resize(NUM_BODIES);
+    for (int i = 0; i < NUM_BODIES; ++i) {
+        glm::dvec3 position, velocity;
+        initialState(i, position, velocity);
+        s.x[i] = position.x;
+        s.y[i] = position.y;
+        s.z[i] = position.z;
+        s.vx[i] = velocity.x;
+        s.vy[i] = velocity.y;
+        s.vz[i] = velocity.z;
+        s.gm[i] = G * solarSystemData[i].mass;
+        s.pinned[i] = (i == 0);
+    }
+}
+
+// Partículas de teste: cinturão principal (entre Marte e Júpiter) e de Kuiper (além de Netuno)
+inline void addSolarSystemBelts(ParticleStore& p, size_t asteroids, size_t kuiper) {
+    double sunGM = G * solarSystemData[0].mass;
+    addBeltParticles(p, asteroids,
+        1.1 * solarSystemData[4].orbitRadius, 0.9 * solarSystemData[5].orbitRadius, 10.0, sunGM, 1);
+    addBeltParticles(p, kuiper,
+        1.1 * solarSystemData[8].orbitRadius, 1.65 * solarSystemData[8].orbitRadius, 15.0, sunGM, 2);
+}
@@ -0,0 +1,302 @@
+#pragma once
+
+#include "libs.h"
+#include "mesh.h"
+#include "frustum.h"
+#include "gpu_memory.h"
+#include "shader.h"
+#include "texture_loader.h"
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+
+// Todos os astros a partir de esferas unitárias indexadas (VBO + EBO), um
+// buffer por instância com posição, escala e camada da textura, e as texturas
+// num GL_TEXTURE_2D_ARRAY (camada i = astro i). A cada quadro os astros fora
+// do frustum são descartados e cada um dos outros cai num balde pelo raio
+// projetado na tela: uma das SPHERE_LOD_COUNT malhas (cada LOD com metade das
+// divisões do anterior) ou, abaixo de poucos pixels, um ponto. As instâncias
+// ficam ordenadas por balde (Sol por LOD, planetas por LOD, pontos), então é
+// uma chamada instanciada por balde não vazio, com as permutações SUN_PROGRAM,
+// PLANET_PROGRAM e POINT_PROGRAM de shader.h. As camadas chegam já
+// decodificadas (texture_loader.h), em qualquer ordem, por uploadLayer.
+// Câmera e luz vêm do uniform block Frame (frame_uniforms.h).
+struct SphereInstance {
+    float x, y, z, scale;
+    float layer;
+};
+
+// Raio projetado mínimo (pixels) de cada LOD; abaixo do último vira ponto
+const int SPHERE_LOD_COUNT = 3;
+const float SPHERE_LOD_PIXELS[SPHERE_LOD_COUNT] = { 64.0f, 16.0f, 3.0f };
+
+// Baldes: Sol por LOD, planetas por LOD e os pontos (Sol e planetas juntos)
+const int SPHERE_POINT_BUCKET = 2 * SPHERE_LOD_COUNT;
+const int SPHERE_BUCKETS = SPHERE_POINT_BUCKET + 1;
+
+struct SphereLod {
+    GLsizei indexCount;
+    size_t indexOffset;     // Em bytes no EBO
+};
+
+struct SphereRenderer {
+    GLuint VAO = 0, VBO = 0, EBO = 0, instanceVBO = 0, textureArray = 0;
+    SphereLod lods[SPHERE_LOD_COUNT] = {};
+    GLint pointVertex = 0;          // Vértice único no centro, para os pontos
+    size_t instanceCapacity = 0;
+    size_t bucketFirst[SPHERE_BUCKETS] = {};
+    size_t bucketCount[SPHERE_BUCKETS] = {};
+    int layerWidth = 0, layerHeight = 0;
+    std::vector<unsigned char> resampled, mipLevel, nextMipLevel;   // Rascunho de uploadLayer
+    std::vector<SphereInstance> instances;
+    std::vector<SphereInstance> visible;    // Instâncias visíveis, antes da ordenação
+    std::vector<int> visibleBucket;
+
+    // LOD 0 com stacks × sectors; os seguintes com metade das divisões (mínimo 4)
+    void init(const std::vector<const char*>& textureFiles, int stacks, int sectors) {
+        std::vector<float> vertices, lodVertices;
+        std::vector<unsigned> indices, lodIndices;
+        for (int l = 0; l < SPHERE_LOD_COUNT; ++l) {
+            createSphereMesh(stacks, sectors, lodVertices, lodIndices);
+            unsigned baseVertex = static_cast<unsigned>(vertices.size() / 8);
+            lods[l].indexCount = static_cast<GLsizei>(lodIndices.size());
+            lods[l].indexOffset = indices.size() * sizeof(unsigned);
+            vertices.insert(vertices.end(), lodVertices.begin(), lodVertices.end());
+            for (unsigned index : lodIndices) indices.push_back(baseVertex + index);
+            stacks = std::max(4, stacks / 2);
+            sectors = std::max(4, sectors / 2);
+        }
+        // Centro da esfera, com a coordenada de textura no meio da camada
+        pointVertex = static_cast<GLint>(vertices.size() / 8);
+        vertices.insert(vertices.end(), { 0.0f, 0.0f, 0.0f, 0.5f, 0.5f, 0.0f, 0.0f, 1.0f });
+
+        glGenVertexArrays(1, &VAO);
+        VBO = genTrackedBuffer(MemoryCategory::Mesh, "sphere vertices");
+        EBO = genTrackedBuffer(MemoryCategory::Mesh, "sphere indices");
+        instanceVBO = genTrackedBuffer(MemoryCategory::Dynamic, "sphere instances");
+
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        trackedBufferData(GL_ARRAY_BUFFER, VBO, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        trackedBufferData(GL_ELEMENT_ARRAY_BUFFER, EBO, indices.size() * sizeof(unsigned), indices.data(), GL_STATIC_DRAW);
+
+        // Posição, textura e normal por vértice
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(5 * sizeof(float)));
+        glEnableVertexAttribArray(2);
+
+        // Posição + escala e camada por instância
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        setInstanceOffset(0);
+        glEnableVertexAttribArray(3);
+        glVertexAttribDivisor(3, 1);
+        glEnableVertexAttribArray(4);
+        glVertexAttribDivisor(4, 1);
+
+        glBindVertexArray(0);
+
+        allocateTextures(textureFiles);
+    }
+
+    // Todas as camadas têm o tamanho da primeira textura legível (lido só do
+    // cabeçalho com stbi_info, antes da decodificação); as de outro tamanho
+    // são reamostradas (vizinho mais próximo) em uploadLayer
+    void allocateTextures(const std::vector<const char*>& files) {
+        textureArray = genTrackedTexture("body textures");
+        glBindTexture(GL_TEXTURE_2D_ARRAY, textureArray);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+        for (const char* file : files) {
+            int nrChannels;
+            if (stbi_info(file, &layerWidth, &layerHeight, &nrChannels)) break;
+        }
+        // Cadeia completa de níveis, preenchida camada a camada por uploadLayer
+        int width = layerWidth, height = layerHeight;
+        size_t bytes = 0;
+        for (GLint level = 0; width > 0; ++level) {
+            glTexImage3D(GL_TEXTURE_2D_ARRAY, level, GL_RGB8, width, height,
+                         static_cast<GLsizei>(files.size()), 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+            bytes += static_cast<size_t>(width) * height * files.size() * 3;
+            if (width == 1 && height == 1) break;
+            width = std::max(1, width / 2);
+            height = std::max(1, height / 2);
+        }
+        // Uma camada por astro
+        std::vector<std::string> owners;
+        for (const char* file : files) owners.push_back(memoryOwnerName(file));
+        trackTextureBytes(textureArray, bytes);
+        MemoryRegistry::instance().setOwners(MemoryObject::Texture, textureArray, owners);
+    }
+
+    // Envia uma camada com 3 canais (AsyncImageDecoder). Os mipmaps de um
+    // arquivo assado vão direto; sem eles (ou se a camada foi reamostrada) a
+    // cadeia desta camada é gerada na CPU com downsampleLevel, no mesmo espaço
+    // linear do bake. glGenerateMipmap refaria os níveis de todas as camadas
+    // e descartaria as cadeias assadas.
+    void uploadLayer(size_t layer, const DecodedImage& image) {
+        if (layerWidth == 0 || !image.pixels) return;
+        const unsigned char* pixels = image.pixels;
+        bool sameSize = image.width == layerWidth && image.height == layerHeight;
+        if (!sameSize) {
+            resampled.resize(static_cast<size_t>(layerWidth) * layerHeight * 3);
+            for (int y = 0; y < layerHeight; ++y) {
+                const unsigned char* row = image.pixels + static_cast<size_t>(y * image.height / layerHeight) * image.width * 3;
+                for (int x = 0; x < layerWidth; ++x) {
+                    const unsigned char* src = row + static_cast<size_t>(x * image.width / layerWidth) * 3;
+                    unsigned char* dst = &resampled[(static_cast<size_t>(y) * layerWidth + x) * 3];
+                    dst[0] = src[0];
+                    dst[1] = src[1];
+                    dst[2] = src[2];
+                }
+            }
+            pixels = resampled.data();
+        }
+        glBindTexture(GL_TEXTURE_2D_ARRAY, textureArray);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, static_cast<GLint>(layer), layerWidth, layerHeight, 1,
+                        GL_RGB, GL_UNSIGNED_BYTE, pixels);
+        if (sameSize && !image.mips.empty()) {
+            for (size_t l = 0; l < image.mips.size(); ++l) {
+                const ImageLevel& level = image.mips[l];
+                glTexSubImage3D(GL_TEXTURE_2D_ARRAY, static_cast<GLint>(l + 1), 0, 0, static_cast<GLint>(layer),
+                                level.width, level.height, 1, GL_RGB, GL_UNSIGNED_BYTE, level.pixels);
+            }
+        } else {
+            int width = layerWidth, height = layerHeight;
+            const unsigned char* src = pixels;
+            for (GLint level = 1; width > 1 || height > 1; ++level) {
+                downsampleLevel(src, width, height, 3, nextMipLevel, width, height);
+                mipLevel.swap(nextMipLevel);
+                src = mipLevel.data();
+                glTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, static_cast<GLint>(layer), width, height, 1,
+                                GL_RGB, GL_UNSIGNED_BYTE, src);
+            }
+        }
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    }
+
+    // Depois de todas as camadas: libera o rascunho
+    void finishTextures() {
+        std::vector<unsigned char>().swap(resampled);
+        std::vector<unsigned char>().swap(mipLevel);
+        std::vector<unsigned char>().swap(nextMipLevel);
+    }
+
+    // Aponta os atributos por instância para a instância first do buffer (o
+    // GL 3.3 não tem base instance); o VAO e o instanceVBO devem estar ligados
+    void setInstanceOffset(size_t first) {
+        size_t base = first * sizeof(SphereInstance);
+        glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(SphereInstance), (void*)base);
+        glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(SphereInstance), (void*)(base + 4 * sizeof(float)));
+    }
+
+    // Atualiza o buffer de instâncias com os astros visíveis (astro i usa a
+    // camada i), ordenados por balde com uma contagem por balde (counting sort)
+    template <typename Body>
+    void update(const std::vector<Body>& bodies, double positionScale, const glm::mat4& view,
+                const glm::mat4& projection, const glm::vec3& cameraPosition, int viewportHeight) {
+        Frustum frustum(projection * view);
+        float pixelsPerUnit = projection[1][1] * 0.5f * static_cast<float>(viewportHeight);
+
+        visible.clear();
+        visibleBucket.clear();
+        std::fill(std::begin(bucketCount), std::end(bucketCount), 0);
+        for (size_t i = 0; i < bodies.size(); ++i) {
+            SphereInstance inst;
+            inst.x = static_cast<float>(bodies[i].position.x / positionScale);
+            inst.y = static_cast<float>(bodies[i].position.y / positionScale);
+            inst.z = static_cast<float>(bodies[i].position.z / positionScale);
+            inst.scale = static_cast<float>(bodies[i].radius);
+            inst.layer = static_cast<float>(i);
+
+            glm::vec3 center(inst.x, inst.y, inst.z);
+            if (!frustum.sphereVisible(center, inst.scale)) continue;
+
+            float pixels = projectedRadius(inst.scale, glm::length(center - cameraPosition), pixelsPerUnit);
+            int lod = 0;
+            while (lod < SPHERE_LOD_COUNT && pixels < SPHERE_LOD_PIXELS[lod]) ++lod;
+            int bucket = lod == SPHERE_LOD_COUNT ? SPHERE_POINT_BUCKET
+                                                 : (bodies[i].isSun ? 0 : SPHERE_LOD_COUNT) + lod;
+            visible.push_back(inst);
+            visibleBucket.push_back(bucket);
+            ++bucketCount[bucket];
+        }
+
+        size_t offset = 0;
+        size_t next[SPHERE_BUCKETS];
+        for (int b = 0; b < SPHERE_BUCKETS; ++b) {
+            bucketFirst[b] = next[b] = offset;
+            offset += bucketCount[b];
+        }
+        instances.resize(visible.size());
+        for (size_t v = 0; v < visible.size(); ++v) {
+            instances[next[visibleBucket[v]]++] = visible[v];
+        }
+
+        if (instances.empty()) return;
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        size_t bytes = instances.size() * sizeof(SphereInstance);
+        if (instances.size() > instanceCapacity) {
+            instanceCapacity = instances.size();
+            trackedBufferData(GL_ARRAY_BUFFER, instanceVBO, bytes, instances.data(), GL_STREAM_DRAW);
+        } else {
+            glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, instances.data());
+        }
+    }
+
+    // Sol, planetas e pontos, um glUseProgram por permutação usada; deixa
+    // ativo o programa do último balde desenhado
+    void draw(ShaderCache& shaders) {
+        if (instances.empty()) return;
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, textureArray);
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+
+        drawMeshes(shaders, SUN_PROGRAM, 0);
+        drawMeshes(shaders, PLANET_PROGRAM, SPHERE_LOD_COUNT);
+
+        size_t points = bucketCount[SPHERE_POINT_BUCKET];
+        if (points > 0) {
+            glUseProgram(shaders.get(POINT_PROGRAM));
+            glEnable(GL_PROGRAM_POINT_SIZE);
+            setInstanceOffset(bucketFirst[SPHERE_POINT_BUCKET]);
+            glDrawArraysInstanced(GL_POINTS, pointVertex, 1, static_cast<GLsizei>(points));
+        }
+
+        setInstanceOffset(0);
+        glBindVertexArray(0);
+    }
+
+    // Os SPHERE_LOD_COUNT baldes a partir de firstBucket com o mesmo programa
+    void drawMeshes(ShaderCache& shaders, unsigned features, int firstBucket) {
+        bool bound = false;
+        for (int l = 0; l < SPHERE_LOD_COUNT; ++l) {
+            size_t count = bucketCount[firstBucket + l];
+            if (count == 0) continue;
+            if (!bound) {
+                glUseProgram(shaders.get(features));
+                bound = true;
+            }
+            setInstanceOffset(bucketFirst[firstBucket + l]);
+            glDrawElementsInstanced(GL_TRIANGLES, lods[l].indexCount, GL_UNSIGNED_INT,
+                                    (void*)lods[l].indexOffset, static_cast<GLsizei>(count));
+        }
+    }
+
+    void destroy() {
+        glDeleteVertexArrays(1, &VAO);
+        deleteTrackedBuffer(VBO);
+        deleteTrackedBuffer(EBO);
+        deleteTrackedBuffer(instanceVBO);
+        deleteTrackedTexture(textureArray);
+    }
+};
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+// Texturas pré-processadas: o passo de bake (main_bake.cpp) decodifica cada
+// imagem de assets/ uma vez e grava um arquivo cru com a cadeia de mipmaps
+// completa; em execução o arquivo é mapeado com mmap e cada nível vai direto
+// para o glTexImage2D / glTexSubImage3D, sem decodificação nem cópia.
+//
+// Formato (little-endian, sem padding): BakedHeader, levels × BakedLevel e os
+// pixels de cada nível, linhas contíguas (GL_UNPACK_ALIGNMENT = 1).
+const char* const BAKED_TEXTURE_DIR = "assets/baked";
+const uint32_t BAKED_TEXTURE_MAGIC = 0x54474349;   // "ICGT"
+const uint32_t BAKED_TEXTURE_VERSION = 1;
+const uint32_t BAKED_TEXTURE_MAX_SIZE = 1u << 16;  // Lado máximo aceito (mantém w·h·canais sem overflow)
+
+struct BakedHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t width, height;
+    uint32_t channels;
+    uint32_t levels;
+    uint32_t flipped;       // Linhas invertidas como no stbi_set_flip_vertically_on_load
+    uint32_t reserved;      // Alinha a tabela de níveis em 8 bytes
+};
+
+struct BakedLevel {
+    uint32_t width, height;
+    uint64_t offset;        // A partir do começo do arquivo
+    uint64_t size;
+};
+
+// "assets/2k_sun.jpg" -> "assets/baked/2k_sun.jpg.tex"
+inline std::string bakedTexturePath(const char* file) {
+    const char* name = std::strrchr(file, '/');
+    name = name ? name + 1 : file;
+    return std::string(BAKED_TEXTURE_DIR) + "/" + name + ".tex";
+}
+
+// Arquivo mapeado só para leitura; desfeito no destrutor
+class MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() { close(); }
+
+    bool open(const char* path) {
+        close();
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* mapped = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped != MAP_FAILED) {
+                bytes = static_cast<const unsigned char*>(mapped);
+                length = static_cast<size_t>(info.st_size);
+            }
+        }
+        ::close(fd);    // O mapeamento continua válido
+        return bytes != nullptr;
+    }
+
+    void close() {
+        if (bytes) munmap(const_cast<unsigned char*>(bytes), length);
+        bytes = nullptr;
+        length = 0;
+    }
+
+    const unsigned char* data() const { return bytes; }
+    size_t size() const { return length; }
+
+private:
+    const unsigned char* bytes = nullptr;
+    size_t length = 0;
+};
+
+inline bool fileModifiedTime(const char* path, struct timespec& out) {
+    struct stat info;
+    if (stat(path, &info) != 0) return false;
+    out = info.st_mtim;
+    return true;
+}
+
+// Número de níveis da cadeia completa até 1×1
+inline uint32_t fullMipChainLength(uint32_t width, uint32_t height) {
+    uint32_t levels = 1;
+    while (width > 1 || height > 1) {
+        width = std::max(1u, width / 2);
+        height = std::max(1u, height / 2);
+        ++levels;
+    }
+    return levels;
+}
+
+// Mapeia o arquivo assado de source. Falha (e quem chama decodifica a imagem
+// original) se ele não existe, é mais velho que a fonte, tem outro número de
+// canais ou orientação, está truncado, ou se a tabela de níveis não descreve
+// exatamente a cadeia completa (tamanhos que não batem com as dimensões
+// fariam o upload ler além do mapeamento).
+inline std::shared_ptr<MappedFile> openBakedTexture(const char* source, int channels, bool flipped) {
+    std::string path = bakedTexturePath(source);
+    struct timespec sourceTime, bakedTime;
+    if (!fileModifiedTime(path.c_str(), bakedTime)) return nullptr;
+    if (fileModifiedTime(source, sourceTime) &&
+        (sourceTime.tv_sec > bakedTime.tv_sec ||
+         (sourceTime.tv_sec == bakedTime.tv_sec && sourceTime.tv_nsec > bakedTime.tv_nsec))) {
+        return nullptr;
+    }
+
+    std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>();
+    if (!file->open(path.c_str()) || file->size() < sizeof(BakedHeader)) return nullptr;
+
+    const BakedHeader* header = reinterpret_cast<const BakedHeader*>(file->data());
+    if (header->magic != BAKED_TEXTURE_MAGIC || header->version != BAKED_TEXTURE_VERSION) return nullptr;
+    if (channels != 0 && header->channels != static_cast<uint32_t>(channels)) return nullptr;
+    if (header->flipped != (flipped ? 1u : 0u)) return nullptr;
+    if (header->channels < 1 || header->channels > 4) return nullptr;
+    if (header->width == 0 || header->height == 0 ||
+        header->width > BAKED_TEXTURE_MAX_SIZE || header->height > BAKED_TEXTURE_MAX_SIZE) return nullptr;
+    if (header->levels != fullMipChainLength(header->width, header->height)) return nullptr;
+
+    size_t tableEnd = sizeof(BakedHeader) + header->levels * sizeof(BakedLevel);
+    if (file->size() < tableEnd) return nullptr;
+    const BakedLevel* levels = reinterpret_cast<const BakedLevel*>(file->data() + sizeof(BakedHeader));
+    uint32_t width = header->width, height = header->height;
+    for (uint32_t l = 0; l < header->levels; ++l) {
+        const BakedLevel& level = levels[l];
+        if (level.width != width || level.height != height) return nullptr;
+        if (level.size != static_cast<uint64_t>(width) * height * header->channels) return nullptr;
+        if (level.offset > file->size() || level.size > file->size() - level.offset) return nullptr;
+        width = std::max(1u, width / 2);
+        height = std::max(1u, height / 2);
+    }
+    return file;
+}
+
+// Conversão sRGB <-> linear para filtrar os mipmaps no espaço linear
+inline float srgbToLinear(float c) {
+    return c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+}
+
+inline float linearToSrgb(float c) {
+    c = std::min(1.0f, std::max(0.0f, c));
+    return c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+}
+
+// Nível seguinte da cadeia por média de caixa 2×2 (a última linha/coluna de
+// tamanhos ímpares é repetida). RGB é filtrado em linear e o alfa direto.
+inline void downsampleLevel(const unsigned char* src, int width, int height, int channels,
+                            std::vector<unsigned char>& dst, int& dstWidth, int& dstHeight) {
+    static const std::vector<float> toLinear = [] {
+        std::vector<float> table(256);
+        for (int i = 0; i < 256; ++i) table[i] = srgbToLinear(i / 255.0f);
+        return table;
+    }();
+
+    dstWidth = std::max(1, width / 2);
+    dstHeight = std::max(1, height / 2);
+    dst.resize(static_cast<size_t>(dstWidth) * dstHeight * channels);
+    int colorChannels = (channels == 2 || channels == 4) ? channels - 1 : channels;
+    for (int y = 0; y < dstHeight; ++y) {
+        int y0 = std::min(2 * y, height - 1), y1 = std::min(2 * y + 1, height - 1);
+        for (int x = 0; x < dstWidth; ++x) {
+            int x0 = std::min(2 * x, width - 1), x1 = std::min(2 * x + 1, width - 1);
+            const unsigned char* p[4] = {
+                src + (static_cast<size_t>(y0) * width + x0) * channels,
+                src + (static_cast<size_t>(y0) * width + x1) * channels,
+                src + (static_cast<size_t>(y1) * width + x0) * channels,
+                src + (static_cast<size_t>(y1) * width + x1) * channels,
+            };
+            unsigned char* out = &dst[(static_cast<size_t>(y) * dstWidth + x) * channels];
+            for (int c = 0; c < channels; ++c) {
+                if (c < colorChannels) {
+                    float sum = toLinear[p[0][c]] + toLinear[p[1][c]] + toLinear[p[2][c]] + toLinear[p[3][c]];
+                    out[c] = static_cast<unsigned char>(std::lround(linearToSrgb(0.25f * sum) * 255.0f));
+                } else {
+                    out[c] = static_cast<unsigned char>((p[0][c] + p[1][c] + p[2][c] + p[3][c] + 2) / 4);
+                }
+            }
+        }
+    }
+}
+
+// Grava a imagem e a cadeia de mipmaps até 1×1 no formato acima
+inline bool writeBakedTexture(const char* path, const unsigned char* pixels, int width, int height,
+                              int channels, bool flipped) {
+    std::vector<std::vector<unsigned char>> chain;
+    std::vector<BakedLevel> levels;
+    chain.emplace_back(pixels, pixels + static_cast<size_t>(width) * height * channels);
+    levels.push_back({ static_cast<uint32_t>(width), static_cast<uint32_t>(height), 0, chain.back().size() });
+    while (width > 1 || height > 1) {
+        std::vector<unsigned char> next;
+        downsampleLevel(chain.back().data(), width, height, channels, next, width, height);
+        levels.push_back({ static_cast<uint32_t>(width), static_cast<uint32_t>(height), 0, next.size() });
+        chain.push_back(std::move(next));
+    }
+
+    BakedHeader header = { BAKED_TEXTURE_MAGIC, BAKED_TEXTURE_VERSION,
+                           levels[0].width, levels[0].height, static_cast<uint32_t>(channels),
+                           static_cast<uint32_t>(levels.size()), flipped ? 1u : 0u, 0 };
+    uint64_t offset = sizeof(BakedHeader) + levels.size() * sizeof(BakedLevel);
+    for (BakedLevel& level : levels) {
+        level.offset = offset;
+        offset += level.size;
+    }
+
+    std::FILE* out = std::fopen(path, "wb");
+    if (!out) return false;
+    bool ok = std::fwrite(&header, sizeof(header), 1, out) == 1 &&
+              std::fwrite(levels.data(), sizeof(BakedLevel), levels.size(), out) == levels.size();
+    for (const std::vector<unsigned char>& level : chain) {
+        ok = ok && std::fwrite(level.data(), 1, level.size(), out) == level.size();
+    }
+    return std::fclose(out) == 0 && ok;
+}
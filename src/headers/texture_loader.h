@@ -0,0 +1,161 @@
+#pragma once
+
+#include "texture_bake.h"
+#include "profiler.h"
+#include "solar_system.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+// Decodificação das texturas em paralelo, fora da thread do GL. start() lança
+// as threads de decodificação (stbi_load) e retorna na hora, então os JPGs são
+// decodificados enquanto a janela e o contexto são criados; cada imagem
+// pronta entra numa fila de conclusão que a thread do GL consome com next()
+// para fazer só o upload. Quando existe uma versão assada da textura
+// (texture_bake.h), ela é só mapeada e já traz todos os níveis de mipmap.
+// Usa stbi_load do physics.h incluído antes (que define a implementação).
+struct ImageRequest {
+    const char* file;
+    int channels;       // Canais pedidos ao stbi_load (0 = os do arquivo)
+};
+
+struct ImageLevel {
+    int width, height;
+    const unsigned char* pixels;
+};
+
+struct DecodedImage {
+    size_t index = 0;   // Posição em requests
+    int width = 0, height = 0, channels = 0;
+    const unsigned char* pixels = nullptr;  // Nível 0; nullptr se a decodificação falhou
+    std::vector<ImageLevel> mips;           // Níveis 1.. do arquivo assado (vazio = gerar no GL)
+    unsigned char* decoded = nullptr;       // Dono dos pixels decodificados pelo stbi_load
+    std::shared_ptr<MappedFile> mapping;    // Ou do arquivo assado mapeado
+
+    void release() {
+        stbi_image_free(decoded);
+        decoded = nullptr;
+        pixels = nullptr;
+        mips.clear();
+        mapping.reset();
+    }
+};
+
+class AsyncImageDecoder {
+public:
+    AsyncImageDecoder() = default;
+    AsyncImageDecoder(const AsyncImageDecoder&) = delete;
+    AsyncImageDecoder& operator=(const AsyncImageDecoder&) = delete;
+    ~AsyncImageDecoder() { stop(); }
+
+    void start(const std::vector<ImageRequest>& imageRequests, bool flipVertically = true,
+               unsigned threads = std::thread::hardware_concurrency()) {
+        stop();
+        requests = imageRequests;
+        flip = flipVertically;
+        nextRequest = 0;
+        consumed = 0;
+        threads = std::max(1u, std::min<unsigned>(threads, static_cast<unsigned>(requests.size())));
+        for (unsigned t = 0; t < threads; ++t) {
+            workers.emplace_back([this] { decodeLoop(); });
+        }
+    }
+
+    // Espera a próxima imagem decodificada (em ordem de conclusão); retorna
+    // false quando todas já foram entregues. Quem recebe chama release().
+    bool next(DecodedImage& out) {
+        if (consumed == requests.size()) return false;
+        std::unique_lock<std::mutex> lock(mutex);
+        ready.wait(lock, [&] { return !completed.empty(); });
+        out = completed.front();
+        completed.pop_front();
+        ++consumed;
+        return true;
+    }
+
+    // Espera as threads e libera o que não foi consumido
+    void stop() {
+        nextRequest = requests.size();
+        for (std::thread& w : workers) w.join();
+        workers.clear();
+        for (DecodedImage& image : completed) image.release();
+        completed.clear();
+        requests.clear();
+        consumed = 0;
+    }
+
+private:
+    void decodeLoop() {
+        stbi_set_flip_vertically_on_load_thread(flip);
+        Profiler::instance().setThreadName("texture decoder");
+        for (;;) {
+            size_t i = nextRequest.fetch_add(1, std::memory_order_relaxed);
+            if (i >= requests.size()) return;
+
+            DecodedImage image;
+            image.index = i;
+            if (!loadBaked(requests[i], image)) {
+                PROFILE_ZONE("decode texture");
+                int fileChannels = 0;
+                image.decoded = stbi_load(requests[i].file, &image.width, &image.height, &fileChannels,
+                                          requests[i].channels);
+                image.pixels = image.decoded;
+                image.channels = requests[i].channels ? requests[i].channels : fileChannels;
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                completed.push_back(image);
+            }
+            ready.notify_one();
+        }
+    }
+
+    bool loadBaked(const ImageRequest& request, DecodedImage& image) {
+        PROFILE_ZONE("map baked texture");
+        std::shared_ptr<MappedFile> file = openBakedTexture(request.file, request.channels, flip);
+        if (!file) return false;
+        const BakedHeader* header = reinterpret_cast<const BakedHeader*>(file->data());
+        const BakedLevel* levels = reinterpret_cast<const BakedLevel*>(file->data() + sizeof(BakedHeader));
+        image.width = static_cast<int>(header->width);
+        image.height = static_cast<int>(header->height);
+        image.channels = static_cast<int>(header->channels);
+        image.pixels = file->data() + levels[0].offset;
+        for (uint32_t l = 1; l < header->levels; ++l) {
+            image.mips.push_back({ static_cast<int>(levels[l].width), static_cast<int>(levels[l].height),
+                                   file->data() + levels[l].offset });
+        }
+        image.mapping = file;
+        return true;
+    }
+
+    std::vector<ImageRequest> requests;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> nextRequest{ 0 };
+    size_t consumed = 0;
+    bool flip = true;
+
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<DecodedImage> completed;
+};
+
+// Texturas do sistema solar na ordem de solarSystemImages(): céu, astros (RGB,
+// na ordem de solarSystemData) e anéis (na ordem de ringData)
+const size_t SKY_IMAGE = 0;
+const size_t FIRST_BODY_IMAGE = 1;
+const size_t FIRST_RING_IMAGE = FIRST_BODY_IMAGE + NUM_BODIES;
+
+inline std::vector<ImageRequest> solarSystemImages() {
+    std::vector<ImageRequest> images;
+    images.push_back({ skyTextureFile, 0 });
+    for (int i = 0; i < NUM_BODIES; ++i) images.push_back({ solarSystemData[i].textureFile, 3 });
+    for (const RingData& ring : ringData) images.push_back({ ring.textureFile, 0 });
+    return images;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "libs.h"
+#include "gpu_memory.h"
+#include "texture_loader.h"
+
+
+// Liga a textura e envia uma imagem de texture_loader.h como GL_TEXTURE_2D:
+// todos os níveis quando ela vem de um arquivo assado, senão o nível 0
+// seguido de glGenerateMipmap. O tamanho vai para o MemoryRegistry.
+inline void uploadImage2D(GLuint texture, const DecodedImage& image) {
+    if (!image.pixels) return;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    GLenum format = (image.channels == 4) ? GL_RGBA : GL_RGB;
+    size_t texel = static_cast<size_t>(image.channels == 4 ? 4 : 3);
+    size_t bytes = static_cast<size_t>(image.width) * image.height * texel;
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, format, image.width, image.height, 0, format, GL_UNSIGNED_BYTE, image.pixels);
+    for (size_t l = 0; l < image.mips.size(); ++l) {
+        const ImageLevel& level = image.mips[l];
+        glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(l + 1), format, level.width, level.height, 0, format,
+                     GL_UNSIGNED_BYTE, level.pixels);
+        bytes += static_cast<size_t>(level.width) * level.height * texel;
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    if (image.mips.empty()) {
+        glGenerateMipmap(GL_TEXTURE_2D);
+        bytes = mipChainBytes(image.width, image.height, 1, texel);
+    }
+    trackTextureBytes(texture, bytes);
+}
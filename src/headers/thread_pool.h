@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+// Pool de threads persistente com roubo de trabalho para laços paralelos.
+// Cada parallelFor divide [begin, end) em blocos; cada participante recebe
+// uma faixa contígua de blocos e os consome com fetch_add no seu contador.
+// Quem termina cedo rouba blocos das faixas dos outros com o mesmo fetch_add,
+// então não há trava no caminho quente. Como cada bloco escreve só nos seus
+// próprios índices, o resultado não depende do número de threads.
+class ThreadPool {
+public:
+    ThreadPool() = default;
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ~ThreadPool() { stop(); }
+
+    static unsigned defaultThreadCount() {
+        unsigned n = std::thread::hardware_concurrency();
+        return n > 0 ? n : 1;
+    }
+
+    // threads inclui a thread chamadora; 1 = execução serial
+    void start(unsigned threads) {
+        stop();
+        if (threads < 1) threads = 1;
+        lanes.reset(new Lane[threads]);
+        laneCount = threads;
+        quit = false;
+        unsigned long long current = generation;
+        for (unsigned t = 1; t < threads; ++t) {
+            workers.emplace_back([this, t, current] { workerLoop(t, current); });
+        }
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            quit = true;
+            ++generation;
+        }
+        wake.notify_all();
+        for (std::thread& w : workers) w.join();
+        workers.clear();
+    }
+
+    unsigned threadCount() const { return laneCount; }
+
+    // fn(chunkBegin, chunkEnd) é chamada para cada bloco de até `grain` índices
+    template <typename Fn>
+    void parallelFor(size_t begin, size_t end, size_t grain, Fn&& fn) {
+        if (end <= begin) return;
+        if (grain < 1) grain = 1;
+        size_t chunks = (end - begin + grain - 1) / grain;
+        if (laneCount <= 1 || chunks <= 1) {
+            fn(begin, end);
+            return;
+        }
+
+        job.begin = begin;
+        job.end = end;
+        job.grain = grain;
+        typedef typename std::remove_reference<Fn>::type Callable;
+        job.ctx = const_cast<void*>(static_cast<const void*>(&fn));
+        job.call = [](void* ctx, size_t b, size_t e) { (*static_cast<Callable*>(ctx))(b, e); };
+
+        // Faixa contígua de blocos por participante
+        for (unsigned t = 0; t < laneCount; ++t) {
+            lanes[t].next.store(chunks * t / laneCount, std::memory_order_relaxed);
+            lanes[t].last = chunks * (t + 1) / laneCount;
+        }
+        pending.store(laneCount - 1, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++generation;
+        }
+        wake.notify_all();
+
+        runLanes(0);
+
+        // Espera os workers saírem do job antes de reutilizar o descritor
+        while (pending.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    struct alignas(64) Lane {
+        std::atomic<size_t> next{ 0 };
+        size_t last = 0;
+    };
+
+    struct Job {
+        size_t begin = 0, end = 0, grain = 1;
+        void* ctx = nullptr;
+        void (*call)(void*, size_t, size_t) = nullptr;
+    };
+
+    void runChunk(size_t chunk) {
+        size_t b = job.begin + chunk * job.grain;
+        size_t e = std::min(job.end, b + job.grain);
+        job.call(job.ctx, b, e);
+    }
+
+    // Consome a própria faixa e depois rouba das outras
+    void runLanes(unsigned self) {
+        for (unsigned k = 0; k < laneCount; ++k) {
+            Lane& lane = lanes[(self + k) % laneCount];
+            for (;;) {
+                size_t chunk = lane.next.fetch_add(1, std::memory_order_relaxed);
+                if (chunk >= lane.last) break;
+                runChunk(chunk);
+            }
+        }
+    }
+
+    void workerLoop(unsigned self, unsigned long long seen) {
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&] { return generation != seen; });
+                seen = generation;
+                if (quit) return;
+            }
+            runLanes(self);
+            pending.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::unique_ptr<Lane[]> lanes;
+    unsigned laneCount = 1;
+    Job job;
+    std::atomic<unsigned> pending{ 0 };
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    unsigned long long generation = 0;
+    bool quit = false;
+};
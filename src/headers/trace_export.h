@@ -0,0 +1,90 @@
+#pragma once
+
+#include "profiler.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+
+// Gravação de uma sessão para o formato de trace do Chrome (JSON de
+// trace events), aberto no Perfetto (ui.perfetto.dev) ou em chrome://tracing.
+// Recebe as zonas de CPU drenadas do Profiler e as passadas de GPU do
+// GpuTimer num anel de tamanho fixo: quando enche, os eventos mais antigos
+// são sobrescritos, então a memória fica limitada e o arquivo traz sempre
+// o trecho mais recente. As passadas de GPU vão numa trilha própria,
+// posicionadas no instante em que foram enviadas, com a duração medida na GPU.
+const size_t TRACE_MAX_EVENTS = 1 << 20;   // ~40 MB
+const uint32_t TRACE_GPU_TRACK = 1000;
+
+struct TraceEvent {
+    const char* name;
+    uint64_t start, duration;   // ns (profileNow)
+    uint32_t track;             // Thread do Profiler ou TRACE_GPU_TRACK
+};
+
+class TraceRecorder {
+public:
+    explicit TraceRecorder(size_t capacity = TRACE_MAX_EVENTS) : events(capacity) {}
+
+    void addCpu(const ProfileEvent& event) {
+        add({ event.name, event.start, event.end - event.start, event.thread });
+    }
+
+    void addGpu(const char* name, uint64_t submitted, double ms) {
+        add({ name, submitted, static_cast<uint64_t>(ms * 1e6), TRACE_GPU_TRACK });
+    }
+
+    size_t size() const { return wrapped ? events.size() : next; }
+
+    // Grava os eventos do anel (do mais antigo ao mais novo); threadNames[i]
+    // dá o nome da trilha da thread i do Profiler
+    bool write(const char* path, const std::vector<std::string>& threadNames) const {
+        std::FILE* out = std::fopen(path, "w");
+        if (!out) return false;
+        std::fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        std::fprintf(out, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"solar system\"}}");
+        for (size_t t = 0; t < threadNames.size(); ++t) {
+            writeTrackName(out, static_cast<uint32_t>(t), threadNames[t].c_str());
+        }
+        writeTrackName(out, TRACE_GPU_TRACK, "GPU");
+
+        size_t count = size();
+        size_t first = wrapped ? next : 0;
+        for (size_t k = 0; k < count; ++k) {
+            const TraceEvent& e = events[(first + k) % events.size()];
+            std::fprintf(out, ",\n{\"name\":\"");
+            writeEscaped(out, e.name);
+            std::fprintf(out, "\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                         e.track == TRACE_GPU_TRACK ? "gpu" : "cpu", e.track, e.start * 1e-3, e.duration * 1e-3);
+        }
+        std::fprintf(out, "\n]}\n");
+        return std::fclose(out) == 0;
+    }
+
+private:
+    void add(const TraceEvent& event) {
+        if (events.empty()) return;
+        events[next] = event;
+        if (++next == events.size()) {
+            next = 0;
+            wrapped = true;
+        }
+    }
+
+    static void writeTrackName(std::FILE* out, uint32_t track, const char* name) {
+        std::fprintf(out, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"", track);
+        writeEscaped(out, name);
+        std::fprintf(out, "\"}}");
+    }
+
+    static void writeEscaped(std::FILE* out, const char* text) {
+        for (; *text; ++text) {
+            if (*text == '"' || *text == '\\') std::fputc('\\', out);
+            if (static_cast<unsigned char>(*text) >= 0x20) std::fputc(*text, out);
+        }
+    }
+
+    std::vector<TraceEvent> events;
+    size_t next = 0;
+    bool wrapped = false;
+};
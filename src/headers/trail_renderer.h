@@ -0,0 +1,197 @@
+#pragma once
+
+#include "libs.h"
+#include "sim_thread.h"
+#include "frame_uniforms.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+
+// Rastros das órbitas: a cada passo novo publicado pela física, a posição de
+// cada astro (e de até particleTrails partículas de teste) entra num anel de
+// pontos dentro de um único VBO de tamanho fixo, e cada rastro é desenhado
+// como GL_LINE_STRIP com uma só glMultiDrawArrays.
+//
+// Cada rastro ocupa 2 × capacity vértices e cada ponto é gravado nas duas
+// metades, então os `length` pontos mais recentes são sempre contíguos. O
+// anel tem TRAIL_FRAMES_IN_FLIGHT pontos de folga além de `length`: como a
+// cabeça anda no máximo um ponto por quadro, o ponto sobrescrito no quadro f
+// só foi lido até o quadro f - TRAIL_FRAMES_IN_FLIGHT - 1, e a fence desse
+// quadro é esperada antes da escrita. Com ARB_buffer_storage o VBO fica
+// mapeado de forma persistente; sem ele é mapeado a cada quadro com
+// GL_MAP_UNSYNCHRONIZED_BIT, com as mesmas fences. Usa linkProgram() do
+// shader.h incluído antes.
+const int TRAIL_FRAMES_IN_FLIGHT = 3;
+
+const char* trailVertexShaderSource = "#version 330 core\n" FRAME_UNIFORM_BLOCK R"glsl(
+layout(location=0) in vec3 aPos;
+uniform float invPositionScale;
+uniform int head;           // Posição lógica (mod capacity) do ponto mais novo
+uniform int capacity;
+uniform float trailLength;
+out float Fade;
+void main() {
+    int age = (head - gl_VertexID % capacity + capacity) % capacity;
+    Fade = 1.0 - float(age) / trailLength;
+    gl_Position = projection * view * vec4(aPos * invPositionScale, 1.0);
+}
+)glsl";
+
+const char* trailFragmentShaderSource = R"glsl(
+#version 330 core
+out vec4 FragColor;
+in float Fade;
+uniform vec4 color;
+void main() {
+    FragColor = vec4(color.rgb, color.a * Fade);
+}
+)glsl";
+
+struct TrailRenderer {
+    GLuint program = 0, VAO = 0, VBO = 0;
+    GLint scaleLoc = -1, headLoc = -1;
+    int length = 0;             // Pontos desenhados por rastro (0 = desligado)
+    int capacity = 0;           // length + folga
+    size_t trailCount = 0;      // Astros + partículas com rastro
+    size_t bodyTrails = 0;
+    bool persistent = false;
+    float* mapped = nullptr;    // Mapeamento persistente (ou nullptr)
+
+    uint64_t head = 0;          // Pontos gravados desde o início
+    uint64_t sampledStep = ~0ull;
+    uint64_t frame = 0;
+    GLsync fences[TRAIL_FRAMES_IN_FLIGHT] = {};
+    std::vector<GLint> firsts;
+    std::vector<GLsizei> counts;
+
+    // Memória do VBO: (bodies + particleTrails) × 2 × (trailLength + 3) × 12 bytes
+    void init(size_t bodies, size_t particleTrails, int trailLength) {
+        length = std::max(0, trailLength);
+        if (length < 2) {
+            length = 0;
+            return;
+        }
+        capacity = length + TRAIL_FRAMES_IN_FLIGHT;
+        bodyTrails = bodies;
+        trailCount = bodies + particleTrails;
+
+        program = linkProgram(trailVertexShaderSource, trailFragmentShaderSource);
+        scaleLoc = glGetUniformLocation(program, "invPositionScale");
+        headLoc = glGetUniformLocation(program, "head");
+        glUseProgram(program);
+        glUniform1i(glGetUniformLocation(program, "capacity"), capacity);
+        glUniform1f(glGetUniformLocation(program, "trailLength"), static_cast<float>(length));
+        glUniform4f(glGetUniformLocation(program, "color"), 0.6f, 0.7f, 0.9f, 0.6f);
+
+        glGenVertexArrays(1, &VAO);
+        VBO = genTrackedBuffer(MemoryCategory::Dynamic, "orbit trails");
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        size_t bytes = trailCount * 2 * capacity * 3 * sizeof(float);
+        persistent = GLEW_ARB_buffer_storage || GLEW_VERSION_4_4;
+        if (persistent) {
+            GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            trackedBufferStorage(GL_ARRAY_BUFFER, VBO, bytes, nullptr, flags);
+            mapped = static_cast<float*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(bytes), flags));
+            persistent = mapped != nullptr;
+        }
+        if (!persistent) {
+            trackedBufferData(GL_ARRAY_BUFFER, VBO, bytes, nullptr, GL_DYNAMIC_DRAW);
+        }
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glBindVertexArray(0);
+
+        firsts.resize(trailCount);
+        counts.resize(trailCount);
+    }
+
+    // Grava um ponto por rastro quando a física publicou um passo novo
+    void upload(const PhysicsSnapshot& snapshot) {
+        if (length == 0 || snapshot.steps == sampledStep) return;
+        sampledStep = snapshot.steps;
+
+        // O slot sobrescrito agora foi lido pela última vez TRAIL_FRAMES_IN_FLIGHT + 1 quadros atrás
+        GLsync& fence = fences[frame % TRAIL_FRAMES_IN_FLIGHT];
+        if (fence) {
+            glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, GLuint64(1000000000));
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+
+        float* base = mapped;
+        if (!persistent) {
+            glBindBuffer(GL_ARRAY_BUFFER, VBO);
+            base = static_cast<float*>(glMapBufferRange(GL_ARRAY_BUFFER, 0,
+                trailCount * 2 * capacity * 3 * sizeof(float), GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+            if (!base) return;
+        }
+
+        size_t slot = static_cast<size_t>(head % capacity);
+        size_t particleTrails = std::min(trailCount - bodyTrails, snapshot.particles.size() / 3);
+        for (size_t t = 0; t < trailCount; ++t) {
+            float point[3];
+            if (t < bodyTrails && t < snapshot.x.size()) {
+                point[0] = static_cast<float>(snapshot.x[t]);
+                point[1] = static_cast<float>(snapshot.y[t]);
+                point[2] = static_cast<float>(snapshot.z[t]);
+            } else if (t >= bodyTrails && t - bodyTrails < particleTrails) {
+                std::memcpy(point, &snapshot.particles[3 * (t - bodyTrails)], sizeof(point));
+            } else {
+                continue;
+            }
+            float* trail = base + t * 2 * capacity * 3;
+            if (head == 0) {
+                // Primeiro ponto: preenche o anel todo para não desenhar a origem
+                for (int k = 0; k < 2 * capacity; ++k) std::memcpy(trail + 3 * k, point, sizeof(point));
+            } else {
+                std::memcpy(trail + 3 * slot, point, sizeof(point));
+                std::memcpy(trail + 3 * (slot + capacity), point, sizeof(point));
+            }
+        }
+
+        if (!persistent) glUnmapBuffer(GL_ARRAY_BUFFER);
+        ++head;
+    }
+
+    // Deixa o programa dos rastros ativo
+    void draw(double positionScale) {
+        if (length == 0 || head == 0) return;
+        GLsizei count = static_cast<GLsizei>(std::min<uint64_t>(head, static_cast<uint64_t>(length)));
+        int newest = static_cast<int>((head - 1) % capacity);
+        int start = (newest - count + 1 + capacity) % capacity;
+        for (size_t t = 0; t < trailCount; ++t) {
+            firsts[t] = static_cast<GLint>(t * 2 * capacity + start);
+            counts[t] = count;
+        }
+
+        glUseProgram(program);
+        glUniform1f(scaleLoc, static_cast<float>(1.0 / positionScale));
+        glUniform1i(headLoc, newest);
+        glBindVertexArray(VAO);
+        glMultiDrawArrays(GL_LINE_STRIP, firsts.data(), counts.data(), static_cast<GLsizei>(trailCount));
+        glBindVertexArray(0);
+
+        // Marca o fim das leituras deste quadro
+        GLsync& fence = fences[frame % TRAIL_FRAMES_IN_FLIGHT];
+        if (fence) glDeleteSync(fence);
+        fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        ++frame;
+    }
+
+    void destroy() {
+        for (GLsync& fence : fences) {
+            if (fence) glDeleteSync(fence);
+            fence = nullptr;
+        }
+        if (length == 0) return;
+        if (persistent) {
+            glBindBuffer(GL_ARRAY_BUFFER, VBO);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+        }
+        glDeleteVertexArrays(1, &VAO);
+        deleteTrackedBuffer(VBO);
+        glDeleteProgram(program);
+    }
+};
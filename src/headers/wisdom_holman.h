@@ -0,0 +1,250 @@
+#pragma once
+
+#include "nbody.h"
+#include "gravity.h"
+#include "particles.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+
+
+// Funções de Stumpff C(z) e S(z), com série perto de z = 0
+inline void stumpff(double z, double& c, double& s) {
+    if (std::fabs(z) < 0.1) {
+        c = 1.0 / 2 - z * (1.0 / 24 - z * (1.0 / 720 - z * (1.0 / 40320 - z * (1.0 / 3628800 - z / 479001600.0))));
+        s = 1.0 / 6 - z * (1.0 / 120 - z * (1.0 / 5040 - z * (1.0 / 362880 - z * (1.0 / 39916800 - z / 6227020800.0))));
+    } else if (z > 0.0) {
+        double sz = std::sqrt(z);
+        c = (1.0 - std::cos(sz)) / z;
+        s = (sz - std::sin(sz)) / (z * sz);
+    } else {
+        double sz = std::sqrt(-z);
+        c = (std::cosh(sz) - 1.0) / -z;
+        s = (std::sinh(sz) - sz) / (-z * sz);
+    }
+}
+
+// Propaga (r, v) por dt numa órbita kepleriana de parâmetro mu = GM em torno
+// da origem, usando a variável universal χ (elipse, parábola e hipérbole) e
+// iteração de Laguerre–Conway. Retorna false se não convergir.
+inline bool keplerDrift(double mu, double& x, double& y, double& z,
+                        double& vx, double& vy, double& vz, double dt) {
+    const double PI = 3.14159265358979323846;
+    double r0 = std::sqrt(x * x + y * y + z * z);
+    if (r0 == 0.0 || dt == 0.0) return true;
+
+    double v2 = vx * vx + vy * vy + vz * vz;
+    double sqrtMu = std::sqrt(mu);
+    double alpha = 2.0 / r0 - v2 / mu;             // 1 / semieixo maior
+    double sigma0 = (x * vx + y * vy + z * vz) / sqrtMu;
+
+    // Em órbitas fechadas, só a fração do período importa
+    if (alpha > 0.0) {
+        double period = 2.0 * PI / (sqrtMu * alpha * std::sqrt(alpha));
+        dt = std::fmod(dt, period);
+    }
+
+    double chi = alpha > 0.0 ? sqrtMu * alpha * dt : sqrtMu * dt / r0;
+    double c = 0.5, s = 1.0 / 6.0, zeta = 0.0, r = r0;
+    bool converged = false;
+    for (int it = 0; it < 64; ++it) {
+        zeta = alpha * chi * chi;
+        stumpff(zeta, c, s);
+        double chi2 = chi * chi;
+        double F = sigma0 * chi2 * c + (1.0 - alpha * r0) * chi2 * chi * s + r0 * chi - sqrtMu * dt;
+        r = chi2 * c + sigma0 * chi * (1.0 - zeta * s) + r0 * (1.0 - zeta * c);
+        double F2 = sigma0 * (1.0 - zeta * c) + (1.0 - alpha * r0) * chi * (1.0 - zeta * s);
+
+        const double n = 5.0;
+        double disc = std::sqrt(std::fabs((n - 1.0) * (n - 1.0) * r * r - n * (n - 1.0) * F * F2));
+        double delta = n * F / (r + (r >= 0.0 ? disc : -disc));
+        chi -= delta;
+        if (std::fabs(delta) <= 1e-14 * std::max(1.0, std::fabs(chi))) {
+            converged = true;
+            break;
+        }
+    }
+    if (!converged) return false;
+
+    zeta = alpha * chi * chi;
+    stumpff(zeta, c, s);
+    double chi2 = chi * chi;
+    r = chi2 * c + sigma0 * chi * (1.0 - zeta * s) + r0 * (1.0 - zeta * c);
+
+    double f = 1.0 - chi2 * c / r0;
+    double g = dt - chi2 * chi * s / sqrtMu;
+    double fdot = -sqrtMu * chi * (1.0 - zeta * s) / (r * r0);
+    double gdot = 1.0 - chi2 * c / r;
+
+    double nx = f * x + g * vx, ny = f * y + g * vy, nz = f * z + g * vz;
+    double nvx = fdot * x + gdot * vx, nvy = fdot * y + gdot * vy, nvz = fdot * z + gdot * vz;
+    x = nx; y = ny; z = nz;
+    vx = nvx; vy = nvy; vz = nvz;
+    return true;
+}
+
+// keplerDrift com subdivisão: se a iteração não convergir, tenta as duas
+// metades de dt, até depth níveis. No último nível o trecho restante é feito
+// com um drift–kick–drift de segunda ordem no campo central, para o corpo
+// não ficar parado. Retorna false se precisou desse recurso.
+inline bool keplerDriftSplit(double mu, double& x, double& y, double& z,
+                             double& vx, double& vy, double& vz, double dt, int depth = 10) {
+    if (keplerDrift(mu, x, y, z, vx, vy, vz, dt)) return true;   // Sem convergência o estado fica intacto
+    if (depth > 0) {
+        bool first = keplerDriftSplit(mu, x, y, z, vx, vy, vz, 0.5 * dt, depth - 1);
+        bool second = keplerDriftSplit(mu, x, y, z, vx, vy, vz, 0.5 * dt, depth - 1);
+        return first && second;
+    }
+    double h = 0.5 * dt;
+    x += vx * h; y += vy * h; z += vz * h;
+    double r2 = x * x + y * y + z * z;
+    if (r2 > 0.0) {
+        double k = -mu * dt / (r2 * std::sqrt(r2));
+        vx += k * x; vy += k * y; vz += k * z;
+    }
+    x += vx * h; y += vy * h; z += vz * h;
+    return false;
+}
+
+// Integrador de Wisdom–Holman para sistemas com um corpo central dominante
+// fixo (o Sol, com isSun). Com o Sol parado a separação é exata:
+//   H = Σ (v²/2 − GM☉/r)  +  Σ interações entre planetas
+// A parte kepleriana é resolvida analiticamente por keplerDrift e as
+// interações entram como kicks (KDK, com a força do fim reaproveitada).
+struct WisdomHolman {
+    bool forcesValid = false;           // ax/ay/az = só interações, nas posições atuais
+    bool particleForcesValid = false;
+    bool warned = false;
+
+    void invalidate() {
+        forcesValid = false;
+        particleForcesValid = false;
+    }
+
+    // Corpo fixo de maior GM, ou -1
+    static int centralBody(const BodyStore& s) {
+        int c = -1;
+        for (size_t i = 0; i < s.count; ++i) {
+            if (s.pinned[i] && (c < 0 || s.gm[i] > s.gm[c])) c = static_cast<int>(i);
+        }
+        return c;
+    }
+
+    // Acelerações só das interações: o GM central é zerado durante o cálculo
+    static void interactionAccelerations(BodyStore& s, GravitySolver& solver, int central) {
+        double gmCentral = s.gm[central];
+        s.gm[central] = 0.0;
+        solver.computeAccelerations(s);
+        s.gm[central] = gmCentral;
+    }
+
+    // Retorna quantos corpos precisaram do drift aproximado de keplerDriftSplit
+    template <typename Store>
+    static size_t keplerRange(Store& p, size_t b, size_t e, double mu, double cx, double cy, double cz, double dt,
+                              const unsigned char* pinned) {
+        size_t failures = 0;
+        for (size_t i = b; i < e; ++i) {
+            if (pinned && pinned[i]) continue;
+            double x = p.x[i] - cx, y = p.y[i] - cy, z = p.z[i] - cz;
+            if (!keplerDriftSplit(mu, x, y, z, p.vx[i], p.vy[i], p.vz[i], dt)) ++failures;
+            p.x[i] = x + cx;
+            p.y[i] = y + cy;
+            p.z[i] = z + cz;
+        }
+        return failures;
+    }
+
+    static void reportKeplerFailures(size_t failures, const char* what) {
+        if (failures == 0) return;
+        std::cerr << "Wisdom-Holman: Kepler drift did not converge for " << failures << " " << what
+                  << " even after splitting dt; used an approximate drift" << std::endl;
+    }
+
+    // Retorna false se não houver corpo central fixo (o chamador usa outro integrador)
+    bool step(BodyStore& s, GravitySolver& solver, double dt, ParticleStore* particles, MassiveStages& stages) {
+        int central = centralBody(s);
+        if (central < 0) {
+            if (!warned) {
+                std::cerr << "Wisdom-Holman needs a pinned central body; falling back to leapfrog" << std::endl;
+                warned = true;
+            }
+            return false;
+        }
+        const double mu = s.gm[central];
+        const double cx = s.x[central], cy = s.y[central], cz = s.z[central];
+        ThreadPool* pool = solver.pool;
+        bool parallel = pool && pool->threadCount() > 1;
+
+        if (particles) {
+            stages.begin(s, 2, central);
+            stages.record(s, 0);
+        }
+
+        if (!forcesValid) interactionAccelerations(s, solver, central);
+        kickBodies(s, 0.5 * dt);
+
+        std::atomic<size_t> failures(0);
+        if (parallel && s.count >= PARALLEL_MIN_BODIES) {
+            pool->parallelFor(0, s.count, std::max<size_t>(16, s.count / (pool->threadCount() * 8)),
+                [&](size_t b, size_t e) { failures += keplerRange(s, b, e, mu, cx, cy, cz, dt, s.pinned.data()); });
+        } else {
+            failures += keplerRange(s, 0, s.count, mu, cx, cy, cz, dt, s.pinned.data());
+        }
+        reportKeplerFailures(failures, "bodies");
+
+        interactionAccelerations(s, solver, central);
+        kickBodies(s, 0.5 * dt);
+        forcesValid = true;
+
+        if (particles) {
+            stages.record(s, 1);
+            stepParticles(*particles, stages, mu, cx, cy, cz, dt, pool);
+        }
+        return true;
+    }
+
+    static void kickBodies(BodyStore& s, double h) {
+        for (size_t i = 0; i < s.count; ++i) {
+            if (s.pinned[i]) continue;
+            s.vx[i] += s.ax[i] * h;
+            s.vy[i] += s.ay[i] * h;
+            s.vz[i] += s.az[i] * h;
+        }
+    }
+
+    // Partículas: kick dos planetas (estágio 0), Kepler em torno do Sol, kick (estágio 1)
+    void stepParticles(ParticleStore& p, const MassiveStages& stages, double mu,
+                       double cx, double cy, double cz, double dt, ThreadPool* pool) {
+        ParticleKernel kernel = activeParticleKernel();
+        const bool reuse = particleForcesValid;
+        const size_t n = stages.n;
+        std::atomic<size_t> failures(0);
+
+        auto chunk = [&](size_t b, size_t e) {
+            for (int k = 0; k < 2; ++k) {
+                if (k > 0 || !reuse) {
+                    kernel(p, b, e, &stages.x[k * n], &stages.y[k * n], &stages.z[k * n], stages.gm.data(), n);
+                }
+                double h = 0.5 * dt;
+                for (size_t i = b; i < e; ++i) {
+                    p.vx[i] += p.ax[i] * h;
+                    p.vy[i] += p.ay[i] * h;
+                    p.vz[i] += p.az[i] * h;
+                }
+                if (k == 0) failures += keplerRange(p, b, e, mu, cx, cy, cz, dt, nullptr);
+            }
+        };
+
+        if (pool && pool->threadCount() > 1) {
+            size_t grain = std::max<size_t>(1024, p.count / (pool->threadCount() * 8));
+            grain = (grain + NBODY_PAD - 1) / NBODY_PAD * NBODY_PAD;
+            pool->parallelFor(0, p.count, grain, chunk);
+        } else {
+            chunk(0, p.count);
+        }
+        reportKeplerFailures(failures, "particles");
+        particleForcesValid = true;
+    }
+};
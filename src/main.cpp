@@ -0,0 +1,577 @@
+#include "headers/libs.h"
+#include "headers/options.h"
+#include "headers/physics.h"
+#include "headers/shader.h"
+#include "headers/sphere_renderer.h"
+#include "headers/ring_renderer.h"
+#include "headers/particle_renderer.h"
+#include "headers/trail_renderer.h"
+#include "headers/texture_upload.h"
+#include "headers/offscreen.h"
+#include "headers/frame_readback.h"
+#include "headers/gpu_timer.h"
+#include "headers/trace_export.h"
+#include "headers/input_replay.h"
+#include <filesystem>
+
+
+int main(int argc, char** argv) {
+    SimOptions options = parseOptions(argc, argv);
+    // --profile e --trace usam as mesmas zonas; sem eles as zonas não medem nada
+    Profiler::instance().setEnabled(options.profile || options.trace);
+    Profiler::instance().setThreadName("render");
+
+    // Todas as texturas (céu, astros e anéis) são decodificadas em paralelo
+    // enquanto a janela e o contexto GL são criados; só o upload fica na
+    // thread do GL, mais abaixo. Texturas assadas (./run_bake.sh) são só mapeadas
+    std::vector<ImageRequest> imageRequests = solarSystemImages();
+    AsyncImageDecoder imageDecoder;
+    imageDecoder.start(imageRequests);
+
+    // Com --offscreen não há janela: contexto EGL sem superfície e os quadros
+    // desenhados num FBO e gravados em disco
+    GLFWwindow* window = nullptr;
+    OffscreenContext offscreenContext;
+    if (options.offscreen) {
+        if (!offscreenContext.init()) return -1;
+    } else {
+        if (!glfwInit()) {
+            std::cerr << "Failed to initialize GLFW" << std::endl;
+            return -1;
+        }
+
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+        window = glfwCreateWindow(options.width, options.height, "Solar System Simulation", nullptr, nullptr);
+        if (!window) {
+            std::cerr << "Failed to create GLFW window" << std::endl;
+            glfwTerminate();
+            return -1;
+        }
+
+        glfwMakeContextCurrent(window);
+        // Reprodução sem vsync: mede o renderizador, não o monitor
+        if (options.replay) glfwSwapInterval(0);
+    }
+
+    // Sem GLX (contexto EGL) o glewInit carrega as funções do GL e só falha
+    // na parte do GLX, que não é usada
+    GLenum glewStatus = glewInit();
+    if (options.offscreen && glewStatus == GLEW_ERROR_NO_GLX_DISPLAY) glewStatus = GLEW_OK;
+    if (glewStatus != GLEW_OK) {
+        std::cerr << "Failed to initialize GLEW" << std::endl;
+        return -1;
+    }
+
+    OffscreenTarget offscreenTarget;
+    FrameReadback frameReadback;
+    if (options.offscreen) {
+        std::error_code error;
+        std::filesystem::create_directories(options.frameDir, error);
+        if (error) {
+            std::cerr << "Failed to create " << options.frameDir << ": " << error.message() << std::endl;
+            return -1;
+        }
+        if (!offscreenTarget.init(options.width, options.height)) return -1;
+        frameReadback.init(options.width, options.height, options.frameDir);
+    }
+    
+    // Habilita teste de profundidade (Z-buffer)
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    // Define cor de fundo padrão (preto)
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+
+
+    // Textura do céu estrelado (2k_stars.jpg), preenchida quando a decodificação termina
+    GLuint backgroundTexture = genTrackedTexture("sky");
+    glBindTexture(GL_TEXTURE_2D, backgroundTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    // Criar geometria do background (quad full-screen)
+    float quadVertices[] = {
+        // positions        // texCoords
+        -1.0f,  1.0f, 1.0f, 0.0f, 1.0f,
+        -1.0f, -1.0f, 1.0f, 0.0f, 0.0f,
+        1.0f, -1.0f, 1.0f, 1.0f, 0.0f,
+        
+        -1.0f,  1.0f, 1.0f, 0.0f, 1.0f,
+        1.0f, -1.0f, 1.0f, 1.0f, 0.0f,
+        1.0f,  1.0f, 1.0f, 1.0f, 1.0f
+    };
+
+    // Configura VAO/VBO para o quad de fundo
+    GLuint quadVAO;
+    glGenVertexArrays(1, &quadVAO);
+    GLuint quadVBO = genTrackedBuffer(MemoryCategory::Mesh, "sky quad");
+    glBindVertexArray(quadVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+    trackedBufferData(GL_ARRAY_BUFFER, quadVBO, sizeof(quadVertices), &quadVertices, GL_STATIC_DRAW);
+
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    glBindVertexArray(0);
+
+
+    
+    // Permutações do shader dos astros e do fundo, compiladas sob demanda e
+    // reaproveitadas (céu, Sol e planetas iluminados no mesmo quadro)
+    ShaderCache shaders;
+    shaders.get(SKY_PROGRAM);
+    shaders.get(SUN_PROGRAM);
+    shaders.get(PLANET_PROGRAM);
+
+    // Câmera e luz (Sol na origem, luz branca) num uniform block enviado uma
+    // vez por quadro e lido por todos os programas
+    FrameUniforms frameUniforms;
+    frameUniforms.init();
+
+    std::vector<CelestialBody> bodies;
+    bodies.reserve(NUM_BODIES);
+    
+    // Criação do Sol no centro
+    bodies.emplace_back(
+        glm::dvec3(0.0),
+        glm::dvec3(0.0),
+        solarSystemData[0].mass,
+        solarSystemData[0].radius,
+        solarSystemData[0].color,
+        solarSystemData[0].textureFile,
+        options.radiusScale,
+        true
+    );
+    
+    // Criação dos planetas e definição no vetor bodies
+    for (int i = 1; i < NUM_BODIES; ++i) {
+        glm::dvec3 position, velocity;
+        initialState(i, position, velocity);
+
+        bodies.emplace_back(
+            position,
+            velocity,
+            solarSystemData[i].mass,
+            solarSystemData[i].radius,
+            solarSystemData[i].color,
+            solarSystemData[i].textureFile,
+            options.radiusScale
+        );
+    }
+    
+
+    // Malha, texturas e instâncias compartilhadas por todos os astros
+    std::vector<const char*> textureFiles;
+    for (const auto& body : bodies) textureFiles.push_back(body.textureFile);
+    SphereRenderer sphereRenderer;
+    sphereRenderer.init(textureFiles, STACKS, SECTORS);
+
+    // Anéis (Saturno): uma coroa plana indexada com textura radial
+    GLuint ringProgram = createRingProgram();
+    RingRenderer ringRenderer;
+    ringRenderer.init(ringProgram, options.radiusScale);
+
+    // Upload das texturas na ordem em que ficam prontas
+    DecodedImage image;
+    while (imageDecoder.next(image)) {
+        PROFILE_ZONE("upload texture");
+        if (!image.pixels) {
+            std::cerr << "Failed to load texture: " << imageRequests[image.index].file << std::endl;
+        } else if (image.index == SKY_IMAGE) {
+            uploadImage2D(backgroundTexture, image);
+        } else if (image.index < FIRST_RING_IMAGE) {
+            sphereRenderer.uploadLayer(image.index - FIRST_BODY_IMAGE, image);
+        } else {
+            ringRenderer.uploadTexture(image.index - FIRST_RING_IMAGE, image);
+        }
+        image.release();
+    }
+    sphereRenderer.finishTextures();
+
+    // Cópia do estado inicial para o store da física
+    Simulation sim;
+    sim.dt = timeStep;
+    configureSimulation(sim, options);
+    loadBodyStore(sim.store, bodies, G);
+
+    addSolarSystemBelts(sim.particles, options.asteroids, options.kuiper);
+
+    ParticleRenderer particleRenderer;
+    particleRenderer.init();
+
+    // Rastros das órbitas num anel de pontos de tamanho fixo
+    TrailRenderer trailRenderer;
+    trailRenderer.init(bodies.size(), std::min(options.trailParticles, sim.particles.count), options.trailLength);
+
+    // Memória de GPU e do host por categoria e por astro (o total também vai no relatório do --profile)
+    MemoryRegistry& memory = MemoryRegistry::instance();
+    if (options.profile) std::cerr << memory.report();
+
+    // --replay: câmera, teclas e passo da física de cada quadro vêm do arquivo
+    // e a física anda em lockstep com ele; --record grava esses dados
+    InputReplay replay;
+    bool replaying = options.replay != nullptr;
+    if (replaying) {
+        if (!replay.load(options.replay)) return -1;
+        if (replay.header.dt != sim.dt) {
+            std::cerr << "Warning: recording used dt = " << replay.header.dt << " s, replaying with " << sim.dt << std::endl;
+        }
+        if (replay.header.width != static_cast<uint32_t>(options.width) ||
+            replay.header.height != static_cast<uint32_t>(options.height)) {
+            std::cerr << "Warning: recording was " << replay.header.width << "x" << replay.header.height
+                      << ", replaying at " << options.width << "x" << options.height << std::endl;
+        }
+    }
+    InputRecorder recorder;
+    if (options.record && !replaying &&
+        !recorder.open(options.record, static_cast<uint32_t>(options.width), static_cast<uint32_t>(options.height), sim.dt)) {
+        std::cerr << "Failed to open " << options.record << " for recording" << std::endl;
+    }
+    ReplayStats replayStats(replay.size());
+
+    // A física roda na sua própria thread; o laço de renderização só lê o último estado
+    SimulationThread simThread(sim);
+    simThread.stepsPerSecond = options.stepsPerSecond;
+    simThread.lockstep = replaying;
+    simThread.start();
+
+    // Definição da distância máxima para setup da câmera
+    double maxOrbitDistance = solarSystemData.back().orbitRadius;
+    
+    // Camera setup
+    float cameraDistance = 3.0f * static_cast<float>(maxOrbitDistance / positionScale);
+    float cameraAngle = 0.0f;
+    float cameraHeight = cameraDistance * 0.5f;
+    glm::vec3 cameraTarget(0.0f, 0.0f, 0.0f);
+    glm::vec3 cameraUp(0.0f, 1.0f, 0.0f);
+    
+    float nearPlane = 1.0f;
+    float farPlane = 2.0f * static_cast<float>(maxOrbitDistance / positionScale);
+    glm::mat4 projectionMatrix = glm::perspective(
+        glm::radians(45.0f),
+        static_cast<float>(options.width) / static_cast<float>(options.height),
+        nearPlane,
+        farPlane
+    );
+
+    // Controle de câmera
+    int cameraTargetIndex = 0;  // 0-9 = Segue um corpo
+    float baseCameraDistance = cameraDistance;
+    float cameraFollowDistance = 5.0f;
+    bool backendKeyHeld = false;
+    glm::vec3 cameraPosition(0.0f);
+
+    // Teclas lidas uma vez por quadro (da janela ou da gravação) num bitmask
+    // na ordem desta tabela, que é também a dos bits de InputFrame::keys.
+    // Offscreen sem --replay nenhuma tecla é apertada e a câmera fica parada
+    const int inputKeys[] = {
+        GLFW_KEY_UP, GLFW_KEY_DOWN, GLFW_KEY_LEFT, GLFW_KEY_RIGHT, GLFW_KEY_W, GLFW_KEY_S, GLFW_KEY_B, GLFW_KEY_T,
+        GLFW_KEY_0, GLFW_KEY_1, GLFW_KEY_2, GLFW_KEY_3, GLFW_KEY_4, GLFW_KEY_5, GLFW_KEY_6, GLFW_KEY_7, GLFW_KEY_8, GLFW_KEY_9
+    };
+    uint32_t keys = 0;
+    auto keyPressed = [&](int key) {
+        for (size_t k = 0; k < std::size(inputKeys); ++k) {
+            if (inputKeys[k] == key) return ((keys >> k) & 1u) != 0;
+        }
+        return false;
+    };
+
+    // Com --profile: zonas de CPU e tempos de GPU por passada, resumidos a
+    // cada segundo no título da janela e no stderr
+    Profiler& profiler = Profiler::instance();
+    GpuTimer gpuTimer;
+    gpuTimer.init();
+    ProfileSummary profileSummary;
+    RollingPercentiles frameTimes;
+    uint64_t lastFrameStart = profileNow();
+    uint64_t lastReport = lastFrameStart;
+
+    // Com --trace: os mesmos eventos num anel limitado, gravado como trace
+    // do Chrome na saída ou ao apertar T
+    TraceRecorder traceRecorder(options.trace ? TRACE_MAX_EVENTS : 0);
+    if (options.trace) {
+        memory.add(MemoryObject::Host, reinterpret_cast<uintptr_t>(&traceRecorder), MemoryCategory::Host,
+                   "trace ring", TRACE_MAX_EVENTS * sizeof(TraceEvent));
+    }
+    bool traceKeyHeld = false;
+    auto writeTrace = [&]() {
+        if (traceRecorder.write(options.trace, profiler.threadNames())) {
+            std::cerr << "Trace (" << traceRecorder.size() << " events) written to " << options.trace << std::endl;
+        } else {
+            std::cerr << "Failed to write trace " << options.trace << std::endl;
+        }
+    };
+    auto collectProfile = [&]() {
+        profiler.drain([&](const ProfileEvent& event) {
+            if (options.profile) profileSummary.addCpu(event);
+            if (options.trace) traceRecorder.addCpu(event);
+        });
+    };
+
+    uint64_t frame = 0;
+    uint64_t shownSteps = 0;    // Passo da física desenhado no quadro atual
+    auto keepRunning = [&]() {
+        if (replaying) return frame < replay.size() && !(window && glfwWindowShouldClose(window));
+        if (options.offscreen) return frame < options.frames;
+        return !glfwWindowShouldClose(window);
+    };
+
+    while (keepRunning()) {
+        PROFILE_ZONE("frame");
+        uint64_t replayFrameStart = profileNow();
+        if (profiler.enabled()) {
+            uint64_t frameStart = profileNow();
+            frameTimes.add((frameStart - lastFrameStart) * 1e-6);
+            lastFrameStart = frameStart;
+            gpuTimer.beginFrame([&](const char* name, double ms, uint64_t submitted) {
+                if (options.profile) profileSummary.addGpu(name, ms);
+                if (options.trace) traceRecorder.addGpu(name, submitted, ms);
+            });
+        }
+
+        {
+            PROFILE_PASS(gpuTimer, "clear");
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        }
+
+        // Atualiza posições dos corpos com o último passo completo da física
+        {
+            PROFILE_ZONE("updatePhysics");
+            const PhysicsSnapshot* latest;
+            if (replaying) {
+                uint64_t waitStart = profileNow();
+                latest = &simThread.waitFor(replay.frames[frame].steps);
+                replayStats.addPhysicsWait((profileNow() - waitStart) * 1e-6);
+            } else {
+                latest = &simThread.latest();
+            }
+            const PhysicsSnapshot& snapshot = *latest;
+            shownSteps = snapshot.steps;
+            updatePhysics(snapshot, bodies);
+            particleRenderer.upload(snapshot);
+            trailRenderer.upload(snapshot);
+        }
+
+        glm::mat4 viewMatrix = glm::mat4(1.0f);
+        {
+            PROFILE_ZONE("input");
+            if (replaying) {
+                keys = replay.frames[frame].keys;
+            } else {
+                keys = 0;
+                for (size_t k = 0; window && k < std::size(inputKeys); ++k) {
+                    if (glfwGetKey(window, inputKeys[k]) == GLFW_PRESS) keys |= 1u << k;
+                }
+            }
+
+            // Handle camera selection
+            for (int i = 0; i < NUM_BODIES; ++i) {
+                if (keyPressed(GLFW_KEY_1 + i)) {
+                    cameraTargetIndex = i;
+                    cameraFollowDistance = 5.0f * static_cast<float>(bodies[i].radius);
+                }
+            }
+            if (keyPressed(GLFW_KEY_0)) {
+                cameraTargetIndex = -1;
+            }
+
+            // B alterna entre soma direta e Barnes–Hut e mostra o erro da força
+            bool backendKey = keyPressed(GLFW_KEY_B);
+            if (backendKey && !backendKeyHeld) {
+                simThread.requestBackendToggle();
+            }
+            backendKeyHeld = backendKey;
+
+            // T grava o trace até aqui (a gravação continua)
+            bool traceKey = keyPressed(GLFW_KEY_T);
+            if (traceKey && !traceKeyHeld && options.trace) {
+                collectProfile();
+                writeTrace();
+            }
+            traceKeyHeld = traceKey;
+
+            // Handle camera movement
+            if (cameraTargetIndex != -1) {
+                // Follow selected body
+                glm::vec3 targetPos = glm::vec3(bodies[cameraTargetIndex].position / positionScale);
+            
+                if (keyPressed(GLFW_KEY_UP)) cameraFollowDistance -= 0.1f;
+                if (keyPressed(GLFW_KEY_DOWN)) cameraFollowDistance += 0.1f;
+                if (keyPressed(GLFW_KEY_LEFT)) cameraAngle -= 0.01f;
+                if (keyPressed(GLFW_KEY_RIGHT)) cameraAngle += 0.01f;
+                if (keyPressed(GLFW_KEY_W)) cameraHeight += 0.1f;
+                if (keyPressed(GLFW_KEY_S)) cameraHeight -= 0.1f;
+
+                cameraPosition = targetPos + glm::vec3(
+                    cameraFollowDistance * sin(cameraAngle),
+                    cameraHeight,
+                    cameraFollowDistance * cos(cameraAngle)
+                );
+                cameraTarget = targetPos;
+            
+                viewMatrix = glm::lookAt(cameraPosition, cameraTarget, cameraUp);
+            } else {
+                // Free camera mode
+                if (keyPressed(GLFW_KEY_UP)) cameraDistance -= 0.1f;
+                if (keyPressed(GLFW_KEY_DOWN)) cameraDistance += 0.1f;
+                if (keyPressed(GLFW_KEY_LEFT)) cameraAngle -= 0.01f;
+                if (keyPressed(GLFW_KEY_RIGHT)) cameraAngle += 0.01f;
+                if (keyPressed(GLFW_KEY_W)) cameraHeight += 0.1f;
+                if (keyPressed(GLFW_KEY_S)) cameraHeight -= 0.1f;
+
+                cameraPosition = glm::vec3(
+                    cameraDistance * sin(cameraAngle),
+                    cameraHeight,
+                    cameraDistance * cos(cameraAngle)
+                );
+                cameraTarget = glm::vec3(0.0f);
+            
+                viewMatrix = glm::lookAt(cameraPosition, cameraTarget, cameraUp);
+            }
+
+            // A câmera gravada prevalece: a reprodução não depende de refazer as contas
+            if (replaying) {
+                const InputFrame& recorded = replay.frames[frame];
+                cameraTargetIndex = recorded.followed;
+                cameraPosition = glm::vec3(recorded.position[0], recorded.position[1], recorded.position[2]);
+                cameraTarget = glm::vec3(recorded.target[0], recorded.target[1], recorded.target[2]);
+                viewMatrix = glm::lookAt(cameraPosition, cameraTarget, cameraUp);
+            } else if (recorder.recording()) {
+                recorder.record({ shownSteps, keys, cameraTargetIndex,
+                                  { cameraPosition.x, cameraPosition.y, cameraPosition.z },
+                                  { cameraTarget.x, cameraTarget.y, cameraTarget.z } });
+            }
+            frameUniforms.update(viewMatrix, projectionMatrix, cameraPosition);
+        }
+
+        {
+            PROFILE_PASS(gpuTimer, "sky");
+            glDepthMask(GL_FALSE); // Desativa escrita no depth buffer
+            glDepthFunc(GL_LEQUAL); // Permite profundidade igual
+
+            // Ordem por programa: céu, Sol, planetas, anéis e partículas, um
+            // glUseProgram cada. O quad do fundo já está em coordenadas de clip
+            glUseProgram(shaders.get(SKY_PROGRAM));
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, backgroundTexture);
+            glBindVertexArray(quadVAO);
+            glDrawArrays(GL_TRIANGLES, 0, 6);
+
+            glDepthMask(GL_TRUE); // Reativa escrita no depth buffer
+            glDepthFunc(GL_LESS); // Restaura função padrão
+        }
+
+        // Renderiza o Sol (emissivo) e os planetas (iluminados) por instância,
+        // só os que estão no frustum, com o LOD pelo tamanho na tela
+        {
+            PROFILE_PASS(gpuTimer, "bodies");
+            int framebufferWidth = options.width, framebufferHeight = options.height;
+            if (window) glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+            sphereRenderer.update(bodies, positionScale, viewMatrix, projectionMatrix, cameraPosition,
+                                  framebufferHeight);
+            sphereRenderer.draw(shaders);
+        }
+
+        // Anéis
+        {
+            PROFILE_PASS(gpuTimer, "rings");
+            ringRenderer.draw(bodies, positionScale);
+        }
+
+        // Rastros das órbitas
+        {
+            PROFILE_PASS(gpuTimer, "trails");
+            trailRenderer.draw(positionScale);
+        }
+
+        // Partículas de teste como pontos
+        {
+            PROFILE_PASS(gpuTimer, "particles");
+            particleRenderer.draw(positionScale);
+        }
+
+        {
+            PROFILE_ZONE("present");
+            if (options.offscreen) {
+                frameReadback.capture(frame);
+            } else {
+                glfwSwapBuffers(window);
+                glfwPollEvents();
+            }
+        }
+        ++frame;
+        if (replaying) replayStats.addFrame((profileNow() - replayFrameStart) * 1e-6);
+
+        if (profiler.enabled()) {
+            gpuTimer.endFrame();
+            collectProfile();
+            ++profileSummary.frames;
+            uint64_t now = profileNow();
+            if (options.profile && now - lastReport >= 1000000000ull) {
+                lastReport = now;
+                if (window) {
+                    std::string title = profileSummary.title("Solar System Simulation", frameTimes);
+                    glfwSetWindowTitle(window, (title + " | " + memory.summary()).c_str());
+                }
+                std::cerr << profileSummary.report(frameTimes, profiler.dropped())
+                          << "  " << memory.summary() << "\n";
+                profileSummary.reset();
+            }
+        }
+    }
+
+    simThread.stop();
+
+    if (replaying) std::cerr << replayStats.report();
+    if (recorder.recording()) {
+        uint64_t recorded = recorder.frames;
+        if (recorder.close()) std::cerr << recorded << " frames recorded to " << options.record << std::endl;
+        else std::cerr << "Failed to write recording " << options.record << std::endl;
+    }
+
+    if (options.trace) {
+        collectProfile();
+        writeTrace();
+        memory.remove(MemoryObject::Host, reinterpret_cast<uintptr_t>(&traceRecorder));
+    }
+
+    if (options.offscreen) {
+        frameReadback.finish();
+        std::cerr << frameReadback.writer.written << " frames written to " << options.frameDir;
+        if (frameReadback.writer.failures) std::cerr << " (" << frameReadback.writer.failures << " failed)";
+        std::cerr << std::endl;
+        frameReadback.destroy();
+        offscreenTarget.destroy();
+    }
+
+    // Libera buffers, texturas e shaders
+    sphereRenderer.destroy();
+    ringRenderer.destroy();
+    glDeleteProgram(ringProgram);
+
+    deleteTrackedTexture(backgroundTexture);
+    glDeleteVertexArrays(1, &quadVAO);
+    deleteTrackedBuffer(quadVBO);
+
+
+    particleRenderer.destroy();
+    trailRenderer.destroy();
+    gpuTimer.destroy();
+    frameUniforms.destroy();
+    shaders.destroy();
+
+    // Tudo o que foi registrado já deveria ter sido liberado
+    if (size_t leaks = memory.reportLeaks()) std::cerr << leaks << " resources not freed at exit" << std::endl;
+    if (options.offscreen) offscreenContext.destroy();
+    else glfwTerminate();
+
+    return 0;
+}
\ No newline at end of file
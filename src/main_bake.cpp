@@ -0,0 +1,52 @@
+#define STB_IMAGE_IMPLEMENTATION
+#include "headers/stb_image.h"
+#include "headers/texture_bake.h"
+#include "headers/texture_loader.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+
+// Passo de bake das texturas: decodifica cada imagem usada pelo executável
+// com janela (solarSystemImages) com os mesmos canais e orientação do
+// AsyncImageDecoder e grava em assets/baked/ a imagem crua com todos os
+// mipmaps (filtrados em linear). Um arquivo mais velho que a fonte é
+// ignorado em execução, então basta rodar de novo depois de trocar um asset.
+
+int main() {
+    std::error_code error;
+    std::filesystem::create_directories(BAKED_TEXTURE_DIR, error);
+    if (error) {
+        std::fprintf(stderr, "Failed to create %s: %s\n", BAKED_TEXTURE_DIR, error.message().c_str());
+        return 1;
+    }
+
+    const bool flip = true;     // Mesma orientação do AsyncImageDecoder
+    stbi_set_flip_vertically_on_load(flip);
+
+    int failures = 0;
+    for (const ImageRequest& request : solarSystemImages()) {
+        typedef std::chrono::steady_clock Clock;
+        Clock::time_point start = Clock::now();
+
+        int width, height, fileChannels;
+        unsigned char* pixels = stbi_load(request.file, &width, &height, &fileChannels, request.channels);
+        if (!pixels) {
+            std::fprintf(stderr, "Failed to load texture: %s\n", request.file);
+            ++failures;
+            continue;
+        }
+        int channels = request.channels ? request.channels : fileChannels;
+        std::string path = bakedTexturePath(request.file);
+        bool ok = writeBakedTexture(path.c_str(), pixels, width, height, channels, flip);
+        stbi_image_free(pixels);
+        if (!ok) {
+            std::fprintf(stderr, "Failed to write %s\n", path.c_str());
+            ++failures;
+            continue;
+        }
+
+        double ms = 1e3 * std::chrono::duration<double>(Clock::now() - start).count();
+        std::fprintf(stderr, "%-40s %5dx%-5d %d ch  %7.1f ms\n", path.c_str(), width, height, channels, ms);
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,228 @@
+#include "headers/options.h"
+#include "headers/solar_system.h"
+#include "headers/sim_thread.h"
+#include "headers/mesh.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+// Microbenchmarks dos caminhos quentes, sem janela: passo da física
+// (Simulation::step), publicação + updatePhysics, createSphereMesh e
+// createRingMesh. A saída (CSV ou JSON, em stdout) é feita para ser
+// comparada entre commits.
+
+// Contador de alocações: todo operator new do processo passa por aqui
+static std::atomic<uint64_t> allocationCount{ 0 };
+
+void* operator new(size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+// Versões alinhadas (AlignedAllocator do BodyStore, tipos com alignas grande)
+void* operator new(size_t size, std::align_val_t align) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    size_t alignment = static_cast<size_t>(align);
+    size_t bytes = (std::max<size_t>(size, 1) + alignment - 1) / alignment * alignment;
+    if (void* p = std::aligned_alloc(alignment, bytes)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+
+struct BenchResult {
+    std::string name;
+    std::string param;
+    uint64_t iterations = 0;
+    double nsPerOp = 0.0;
+    double nsPerInteraction = 0.0;  // 0 = não se aplica
+    double allocsPerOp = 0.0;
+    double verticesPerSec = 0.0;    // 0 = não se aplica
+};
+
+// Roda fn uma vez para aquecer e depois dobra as iterações até passar de minTime
+template <typename Fn>
+BenchResult measure(const char* name, const std::string& param, double minTime, Fn&& fn) {
+    typedef std::chrono::steady_clock Clock;
+    fn();
+
+    BenchResult r;
+    r.name = name;
+    r.param = param;
+    uint64_t iterations = 1;
+    while (true) {
+        uint64_t allocs = allocationCount.load(std::memory_order_relaxed);
+        Clock::time_point start = Clock::now();
+        for (uint64_t k = 0; k < iterations; ++k) fn();
+        double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        allocs = allocationCount.load(std::memory_order_relaxed) - allocs;
+
+        if (elapsed >= minTime || iterations >= (1ull << 30)) {
+            r.iterations = iterations;
+            r.nsPerOp = 1e9 * elapsed / iterations;
+            r.allocsPerOp = static_cast<double>(allocs) / iterations;
+            return r;
+        }
+        iterations *= 2;
+    }
+}
+
+// Sistema solar mais n − 9 corpos leves no cinturão principal
+static void loadBenchBodies(BodyStore& s, size_t n) {
+    BodyStore solar;
+    loadSolarSystem(solar);
+    ParticleStore belt;
+    if (n > solar.count) addSolarSystemBelts(belt, n - solar.count, 0);
+
+    s.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        bool isSolar = i < solar.count;
+        size_t k = isSolar ? i : i - solar.count;
+        s.x[i] = isSolar ? solar.x[k] : belt.x[k];
+        s.y[i] = isSolar ? solar.y[k] : belt.y[k];
+        s.z[i] = isSolar ? solar.z[k] : belt.z[k];
+        s.vx[i] = isSolar ? solar.vx[k] : belt.vx[k];
+        s.vy[i] = isSolar ? solar.vy[k] : belt.vy[k];
+        s.vz[i] = isSolar ? solar.vz[k] : belt.vz[k];
+        s.gm[i] = isSolar ? solar.gm[k] : G * 1e20;
+        s.pinned[i] = isSolar && solar.pinned[k];
+    }
+}
+
+// Só o que updatePhysics usa de CelestialBody
+struct BenchBody {
+    glm::dvec3 position;
+};
+
+static void printResults(const std::vector<BenchResult>& results, bool json) {
+    if (json) {
+        std::printf("[\n");
+        for (size_t i = 0; i < results.size(); ++i) {
+            const BenchResult& r = results[i];
+            std::printf("  {\"name\": \"%s\", \"param\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.3f, "
+                        "\"ns_per_interaction\": %.4f, \"allocs_per_op\": %.3f, \"vertices_per_sec\": %.0f}%s\n",
+                        r.name.c_str(), r.param.c_str(), static_cast<unsigned long long>(r.iterations),
+                        r.nsPerOp, r.nsPerInteraction, r.allocsPerOp, r.verticesPerSec,
+                        i + 1 < results.size() ? "," : "");
+        }
+        std::printf("]\n");
+    } else {
+        std::printf("name,param,iterations,ns_per_op,ns_per_interaction,allocs_per_op,vertices_per_sec\n");
+        for (const BenchResult& r : results) {
+            std::printf("%s,%s,%llu,%.3f,%.4f,%.3f,%.0f\n", r.name.c_str(), r.param.c_str(),
+                        static_cast<unsigned long long>(r.iterations), r.nsPerOp, r.nsPerInteraction,
+                        r.allocsPerOp, r.verticesPerSec);
+        }
+    }
+    std::fflush(stdout);
+}
+
+int main(int argc, char** argv) {
+    bool json = false;
+    double minTime = 0.5;
+    size_t maxBodies = 100000;
+    unsigned threads = 1;
+    std::string filter;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* value;
+        if (std::strcmp(argv[i], "--help") == 0 || std::strcmp(argv[i], "-h") == 0) {
+            std::cout << "Usage: " << argv[0] << " [options]\n"
+                      << "  --format=csv|json    output format (default csv)\n"
+                      << "  --min-time=<s>       minimum measured time per case (default 0.5)\n"
+                      << "  --max-bodies=<n>     skip physics cases above n bodies (default 100000)\n"
+                      << "  --threads=<n>        force-loop threads (default 1)\n"
+                      << "  --filter=<text>      only run cases whose name contains text\n";
+            return 0;
+        } else if ((value = optionValue(argv[i], "--format"))) {
+            json = std::strcmp(value, "json") == 0;
+        } else if ((value = optionValue(argv[i], "--min-time"))) {
+            minTime = std::atof(value);
+        } else if ((value = optionValue(argv[i], "--max-bodies"))) {
+            maxBodies = std::strtoull(value, nullptr, 10);
+        } else if ((value = optionValue(argv[i], "--threads"))) {
+            threads = static_cast<unsigned>(std::max(1, std::atoi(value)));
+        } else if ((value = optionValue(argv[i], "--filter"))) {
+            filter = value;
+        } else {
+            std::cerr << "Unknown option: " << argv[i] << std::endl;
+        }
+    }
+    auto enabled = [&](const char* name) { return filter.empty() || std::strstr(name, filter.c_str()); };
+
+    std::cerr << "simd " << simdLevelName(detectSimdLevel()) << ", " << threads << " threads" << std::endl;
+
+    std::vector<BenchResult> results;
+    const size_t bodyCounts[] = { 9, 1000, 10000, 100000 };
+
+    // Passo completo do leapfrog (uma avaliação de força por passo, FSAL)
+    for (ForceBackend backend : { ForceBackend::Direct, ForceBackend::BarnesHut }) {
+        std::string name = std::string("step_") + forceBackendName(backend);
+        if (!enabled(name.c_str())) continue;
+        for (size_t n : bodyCounts) {
+            if (n > maxBodies) continue;
+            Simulation sim;
+            sim.setThreads(threads);
+            sim.solver.backend = backend;
+            loadBenchBodies(sim.store, n);
+            BenchResult r = measure(name.c_str(), std::to_string(n), minTime, [&] { sim.step(); });
+            // A árvore não faz n(n−1) interações: a coluna só vale para a soma direta
+            if (backend == ForceBackend::Direct) r.nsPerInteraction = r.nsPerOp / (static_cast<double>(n) * (n - 1));
+            results.push_back(r);
+        }
+    }
+
+    // Publicação do estado (capture) e cópia para os astros (updatePhysics)
+    if (enabled("update_physics")) {
+        for (size_t n : bodyCounts) {
+            if (n > maxBodies) continue;
+            Simulation sim;
+            loadBenchBodies(sim.store, n);
+            PhysicsSnapshot snapshot;
+            std::vector<BenchBody> bodies(n);
+            uint64_t steps = 0;
+            results.push_back(measure("update_physics", std::to_string(n), minTime, [&] {
+                snapshot.capture(sim, 0.0, ++steps);
+                updatePhysics(snapshot, bodies);
+            }));
+        }
+    }
+
+    // Malhas: esfera unitária indexada (compartilhada por todos os astros) em várias resoluções
+    if (enabled("create_sphere")) {
+        for (int res : { 16, 30, 64, 128 }) {
+            std::vector<float> vertices;
+            std::vector<unsigned> indices;
+            BenchResult r = measure("create_sphere", std::to_string(res) + "x" + std::to_string(res), minTime, [&] {
+                createSphereMesh(res, res, vertices, indices);
+            });
+            r.verticesPerSec = vertices.size() / 8 * 1e9 / r.nsPerOp;
+            results.push_back(r);
+        }
+    }
+
+    // Anel plano indexado (RING_SEGMENTS = 128 no ring_renderer.h)
+    if (enabled("create_ring")) {
+        for (int segments : { 64, 128, 512 }) {
+            std::vector<float> vertices;
+            std::vector<unsigned> indices;
+            BenchResult r = measure("create_ring", std::to_string(segments), minTime, [&] {
+                createRingMesh(segments, vertices, indices);
+            });
+            r.verticesPerSec = vertices.size() / 3 * 1e9 / r.nsPerOp;
+            results.push_back(r);
+        }
+    }
+
+    printResults(results, json);
+    return 0;
+}